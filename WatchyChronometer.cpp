@@ -1,13 +1,13 @@
 #include "WatchyChronometer.h"
-#include "icons.h"
+#include "assets.h"
 #include "moon_bitmaps.h"
+#include "packed_bitmaps.h"
+#include "orbit_lookup.h"
+#include "time_glyphs.h"
+#include <WebServer.h>
 
 #define BORDER_THICKNESS 4
 #define DAY_NIGHT_THICKNESS 3
-#define CENTRE 0
-#define RADIUS 1
-#define SUNRISE 2
-#define SUNSET 3
 #define FIRST_DAY 41
 #define LAST_DAY 121
 #define ZERO_HOUR 6
@@ -18,116 +18,263 @@
 #define ZERO_INDEX_HOUR 17
 // First image at 5pm plus two images per hour puts midnight at index 14
 #define MIDNIGHT_INDEX 14
+// Leap year so the sweep visits every row of the day/night tables
+#define SWEEP_YEAR 2024
+// Bit of the frame and static layer keys that holds darkMode
+#define DARK_MODE_KEY_BIT 9
+// Menus: quiet time before batched up/down presses are pushed,
+// and how long to wait for another press before going back to deep sleep
+#define FAST_BATCH_MS 80
+#define FAST_MENU_TIMEOUT_MS 5000
+// Holding up/down: first repeat after REPEAT_DELAY_MS, then every REPEAT_INTERVAL_MS,
+// and a page at a time after REPEAT_PAGE_AFTER repeats
+#define REPEAT_DELAY_MS 400
+#define REPEAT_INTERVAL_MS 200
+#define REPEAT_PAGE_AFTER 5
+#define LIST_REPEAT_BUTTONS (1 << BUTTON_UP | 1 << BUTTON_DOWN)
+// Shopping list sync: Wi-Fi stays on until a list arrives, BACK is pressed, or this runs out
+#define SYNC_TIMEOUT_MS 120000
+#define SYNC_PORT 80
 
 const uint8_t DISPLAY_CENTRE_X = DISPLAY_WIDTH / 2;
 const uint8_t DISPLAY_CENTRE_Y = DISPLAY_HEIGHT / 2;
 uint16_t foregroundColor = GxEPD_BLACK;
 uint16_t backgroundColor = GxEPD_WHITE;
 uint16_t dayOfYear = 0;
+DayNight dayNight;
+bool locationSet = false;
+float locationLatitude;
+float locationLongitude;
+RTC_DATA_ATTR DayNight solvedDayNight;
+RTC_DATA_ATTR int16_t solvedDay = -1;
+FrameBuffer WatchyChron::frame(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+Rect faceDirty;
 RTC_DATA_ATTR bool showTime = false;
 RTC_DATA_ATTR bool showStats = false;
 RTC_DATA_ATTR bool darkMode = false;
 RTC_DATA_ATTR int listIndex;
-RTC_DATA_ATTR uint8_t prevDay = 0;
-const char *listItems[] = {
-    //  "---------------"
-        "3 red capsicum",
-        "400g mushroom",
-        "1.5kg chicken",
-        "One pc garlic",
-        "1 pkt salad",
-        "3 tins beans",
-        "500ml Ckn Stock",
-        "3 red capsicum",
-        "400g mushroom",
-        "1.5kg chicken",
-        "One pc garlic",
-        "1 pkt salad",
-        "3 tins beans",
-        "500ml Ckn Stock",
-    };
-const uint8_t listLen = 14; // Constant for now while I'm hashing this out
-bool listChecks[listLen];
-
-struct xyPoint {
-  int x;
-  int y;
-};
-
-struct xyPoint rotatePointAround(int x, int y, int ox, int oy, double angle) {
-  // rotate X,Y point around given origin point by a given angle
-  // based on https://gist.github.com/LyleScott/e36e08bfb23b1f87af68c9051f985302#file-rotate_2d_point-py-L38
-  double qx = (double)ox + (cos(angle) * (double)(x - ox)) + (sin(angle) * (double)(y - oy));
-  double qy = (double)oy + (-sin(angle) * (double)(x - ox)) + (cos(angle) * (double)(y - oy));
-  struct xyPoint newPoint;
-  newPoint.x = (int)qx;
-  newPoint.y = (int)qy;
-  return newPoint;
+RTC_DATA_ATTR bool hideChecked = false;
+// Defined by the Watchy library: true until the first deep sleep, so the panel is fully initialised once
+extern RTC_DATA_ATTR bool displayFullInit;
+const char *menuItems[] = {
+    "About Watchy", "Shopping List", "Show Accelerometer",
+    "Set Time",     "Setup WiFi",    "Update Firmware",
+    "Sync NTP",     "Frame Timing",  "Sync List",
+    "Hide Checked"};
+
+void WatchyChron::init(String datetime) {
+    // Watchy::init isn't virtual and answers the minute alarm with its own showWatchFace, which
+    // pushes the whole screen. Alarm wakeups are handled here instead, with the same hardware
+    // setup, so a tick only sends the dirty window; buttons and first boot go to the library.
+    if (esp_sleep_get_wakeup_cause() != ESP_SLEEP_WAKEUP_EXT0) {
+        Watchy::init(datetime);
+        return;
+    }
+    Wire.begin(SDA, SCL);
+    RTC.init();
+    display.epd2.selectSPI(SPI, SPISettings(20000000, MSBFIRST, SPI_MODE0));
+    display.init(0, displayFullInit, 10, true);
+    display.epd2.setBusyCallback(displayBusyCallback);
+    RTC.read(currentTime);
+    if (guiState == WATCHFACE_STATE) {
+        showWatchFace(true);
+        if (settings.vibrateOClock && currentTime.Minute == 0) {
+            vibMotor(75, 4);
+        }
+    } else if (guiState == MAIN_MENU_STATE) {
+        // Menu left open for a whole minute: back to the face
+        if (alreadyInMenu) {
+            showWatchFace(false);
+        } else {
+            alreadyInMenu = true;
+        }
+    }
+    deepSleep();
 }
 
+
 void WatchyChron::drawWatchFace() {
-    dayOfYear = monthStartDay[currentTime.Month] + currentTime.Day;
+    // Only reached through the library's own showWatchFace (first boot), which pushes the
+    // display's buffer, so the frame is copied into it pixel by pixel
+    renderFace();
+    display.drawBitmap(0, 0, frame.getBuffer(), DISPLAY_WIDTH, DISPLAY_HEIGHT, GxEPD_WHITE, GxEPD_BLACK);
+}
+
+
+void WatchyChron::renderFace() {
+    dayOfYear = monthStartDay[currentTime.Month] + currentTime.Day - 1;
+    updateDayNight();
     foregroundColor = darkMode ? GxEPD_BLACK : GxEPD_WHITE;
     backgroundColor = darkMode ? GxEPD_WHITE : GxEPD_BLACK;
-    uint8_t currDay = currentTime.Day;
-    if (currDay != prevDay) {
-      // recalculate sunrise/sunset
-      // redraw day/night line
+    // Everything not marked dirty by the draw calls below is covered by this key
+    dirtyBeginFrame(dayOfYear | darkMode << DARK_MODE_KEY_BIT | showTime << 10 | showStats << 11);
+    // Background, day/night arc and masks only change with the day or a mode toggle
+    uint32_t staticKey = (showTime ? 0 : dayOfYear) | darkMode << DARK_MODE_KEY_BIT | showTime << 10;
+    timingBegin(STAGE_FILL);
+    bool cached = staticLayerRestore(frame, staticKey);
+    if (!cached) {
+        frame.fillScreen(backgroundColor);
     }
-    display.fillScreen(backgroundColor);
-    if (!showTime) {
-      drawDayNight();
+    timingEnd(STAGE_FILL);
+    if (!cached) {
+        if (!showTime) {
+          timingBegin(STAGE_DAY_NIGHT);
+          drawDayNight();
+          timingEnd(STAGE_DAY_NIGHT);
+        }
+        timingBegin(STAGE_MASKS);
+        drawMasks(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        timingEnd(STAGE_MASKS);
+        staticLayerSave(frame, staticKey);
     }
-    prevDay = currDay;
     if (!showTime) {
+      // Sun goes under the masks, so drawSun re-applies them over its own box
+      timingBegin(STAGE_SUN);
       drawSun();
+      timingEnd(STAGE_SUN);
     }
-    drawMasks();
     if (showTime) {
+        timingBegin(STAGE_TIME);
         drawTime();
+        timingEnd(STAGE_TIME);
+        timingBegin(STAGE_DATE);
         drawDate();
+        timingEnd(STAGE_DATE);
     }
     if (showStats) {
+        timingBegin(STAGE_STEPS);
         drawSteps();
+        timingEnd(STAGE_STEPS);
+        timingBegin(STAGE_BATTERY);
         drawBattery();
+        timingEnd(STAGE_BATTERY);
+    }
+    faceDirty = dirtyEndFrame(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+}
+
+
+void WatchyChron::showWatchFace(bool partialRefresh) {
+    if (guiState != WATCHFACE_STATE) {
+        // Panel is showing a menu or app, so nothing from the last face can be reused
+        dirtyInvalidate();
+    }
+    timingBegin(STAGE_FRAME);
+    renderFace();
+    Rect window = partialRefresh ? faceDirty : Rect{0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT};
+    if (!rectIsEmpty(window)) {
+        presentFrame(window);
+    }
+    timingEnd(STAGE_FRAME);
+    if (!rectIsEmpty(window)) {
+        // Same sequence as GxEPD2_BW::display/displayWindow: refresh, then write the window
+        // again so the controller's previous-image RAM matches for the next partial refresh
+        if (partialRefresh) {
+            display.epd2.refresh(window.x, window.y, window.w, window.h);
+        } else {
+            display.epd2.refresh(false);
+        }
+        if (display.epd2.hasFastPartialUpdate) {
+            display.epd2.writeImagePartAgain(frame.getBuffer(), window.x, window.y, DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                                             window.x, window.y, window.w, window.h);
+        }
+        if (!partialRefresh) {
+            display.epd2.powerOff();
+        }
+        timingPanelPush(window.w, window.h);
     }
-    display.setFont(&FreeSansBold9pt7b);
-    display.setTextColor(foregroundColor);
-    display.setCursor(DISPLAY_CENTRE_X, DISPLAY_CENTRE_Y - 30);
+    guiState = WATCHFACE_STATE;
+}
+
+
+void WatchyChron::presentFrame(const Rect &window) {
+    // Straight from the frame to the panel controller; the frame has the panel's layout
+    // (set bits are white), so the display's own buffer isn't involved
+    timingBegin(STAGE_PRESENT);
+    display.epd2.writeImagePart(frame.getBuffer(), window.x, window.y, DISPLAY_WIDTH, DISPLAY_HEIGHT,
+                                window.x, window.y, window.w, window.h);
+    timingEnd(STAGE_PRESENT);
+}
+
+
+void WatchyChron::renderSweep(Print &out, uint16_t firstDay, uint16_t lastDay, uint16_t minuteStep) {
+    // Headless render: step a fake clock through the year and dump each frame as PBM.
+    // Stats are off since the step counter and battery aren't meaningful without a live RTC/sensor.
+    bool savedShowTime = showTime;
+    bool savedShowStats = showStats;
+    showTime = false;
+    showStats = false;
+    tmElements_t yearStart = {};
+    yearStart.Year = CalendarYrToTm(SWEEP_YEAR);
+    yearStart.Month = 1;
+    yearStart.Day = 1;
+    time_t yearStartTime = makeTime(yearStart);
+    for (uint16_t day = firstDay; day <= lastDay; day++) {
+        for (uint16_t minute = 0; minute < MINUTES_PER_DAY; minute += minuteStep) {
+            breakTime(yearStartTime + day * SECS_PER_DAY + minute * SECS_PER_MIN, currentTime);
+            renderFace();
+            frame.writePBM(out);
+        }
+    }
+    showTime = savedShowTime;
+    showStats = savedShowStats;
+}
+
+
+void WatchyChron::setLocation(float latitude, float longitude) {
+    locationLatitude = latitude;
+    locationLongitude = longitude;
+    locationSet = true;
+}
+
+
+void WatchyChron::updateDayNight() {
+    if (!locationSet) {
+        dayNight = lookupDayNight(dayOfYear);
+        return;
+    }
+    // Solve once per day; the result survives deep sleep
+    if (solvedDay != dayOfYear) {
+        solvedDayNight = solveDayNight(dayOfYear, tmYearToCalendar(currentTime.Year), locationLatitude,
+                                       locationLongitude, settings.gmtOffset);
+        solvedDay = dayOfYear;
+    }
+    dayNight = solvedDayNight;
 }
 
 
 void WatchyChron::drawDayNight() {
-    // display.fillScreen(backgroundColor);
-    int dayNightCentre = dayNightLookup[dayOfYear][CENTRE];
-    int dayNightRadius = dayNightLookup[dayOfYear][RADIUS];
-    int dayNightMaskCentre;
-    if (dayNightCentre > 0) {
-        dayNightMaskCentre = dayNightCentre + DAY_NIGHT_THICKNESS;
+    // frame.fillScreen(backgroundColor);
+    int centre = dayNight.centre;
+    int radius = dayNight.radius;
+    int maskCentre;
+    if (centre > 0) {
+        maskCentre = centre + DAY_NIGHT_THICKNESS;
     }
     else {
-        dayNightMaskCentre = dayNightCentre - DAY_NIGHT_THICKNESS;
+        maskCentre = centre - DAY_NIGHT_THICKNESS;
     }
-    display.fillCircle(DISPLAY_WIDTH / 2, dayNightCentre, dayNightRadius, foregroundColor);
-    display.fillCircle(DISPLAY_WIDTH / 2, dayNightMaskCentre, dayNightRadius, backgroundColor);
+    // The frame was just filled with backgroundColor, so only the arc between the circle and
+    // its mask needs drawing
+    frame.fillCrescent(DISPLAY_WIDTH / 2, centre, maskCentre, radius, foregroundColor);
 }
 
 
 void WatchyChron::drawSun() {
-    uint16_t sunriseMinute = dayNightLookup[dayOfYear][SUNRISE];
-    uint16_t sunsetMinute = dayNightLookup[dayOfYear][SUNSET];
-    const uint8_t border_radius = DISPLAY_HEIGHT / 2 - BORDER_THICKNESS / 2;
+    uint16_t sunriseMinute = dayNight.sunrise;
+    uint16_t sunsetMinute = dayNight.sunset;
     const uint8_t sun_icon_width = 65;
     const uint8_t sun_icon_height = 65;
-    // Calculate angular pos in radians of current minute relative to 0 (6am)
-    float currentMinute = currentTime.Hour * 60 + currentTime.Minute;
-    float angle = (currentMinute - ZERO_MINUTE) / MINUTES_PER_DAY * TWO_PI;
-    int sun_x_pos = DISPLAY_CENTRE_X + border_radius * cos(angle) - (sun_icon_width / 2);
-    int sun_y_pos = DISPLAY_CENTRE_Y - border_radius * sin(angle) - (sun_icon_height / 2);
+    // Icon positions around the border for each minute are precomputed (tools/orbit_table.py)
+    int16_t currentMinute = currentTime.Hour * 60 + currentTime.Minute;
+    const uint8_t *orbit = orbitLookup[currentMinute];
+    int sun_x_pos = pgm_read_byte(&orbit[ORBIT_SUN_X]) - ORBIT_SUN_OFFSET;
+    int sun_y_pos = pgm_read_byte(&orbit[ORBIT_SUN_Y]) - ORBIT_SUN_OFFSET;
     bool daytime = currentMinute >= sunriseMinute && currentMinute < sunsetMinute;
+    // Moon is centred inside the sun border, so the sun's box covers both
+    dirtyMark(sun_x_pos, sun_y_pos, sun_icon_width, sun_icon_height);
     if (daytime) {
-        display.drawBitmap(sun_x_pos, sun_y_pos, sunFill, sun_icon_width, sun_icon_height, foregroundColor);
-        display.drawBitmap(sun_x_pos, sun_y_pos, sunBorder, sun_icon_width, sun_icon_height, foregroundColor);
+        frame.drawBitmapFast(sun_x_pos, sun_y_pos, sunFill, sun_icon_width, sun_icon_height, foregroundColor);
+        frame.drawBitmapFast(sun_x_pos, sun_y_pos, sunBorder, sun_icon_width, sun_icon_height, foregroundColor);
     } else {
         // Moon image index calculated from current time
         uint8_t index;
@@ -146,46 +293,71 @@ void WatchyChron::drawSun() {
         // Draw moon bitmap
         const uint8_t moon_icon_width = 33;
         const uint8_t moon_icon_height = 33;
-        int moon_x_pos = DISPLAY_CENTRE_X + border_radius * cos(angle) - (moon_icon_width / 2);
-        int moon_y_pos = DISPLAY_CENTRE_Y - border_radius * sin(angle) - (moon_icon_height / 2);
-        display.drawBitmap(moon_x_pos, moon_y_pos, bmp_moonWax2qrt_array[index], moon_icon_width, moon_icon_height, foregroundColor);
-        display.drawBitmap(sun_x_pos, sun_y_pos, sunBorderNoRays, sun_icon_width, sun_icon_height, foregroundColor);
+        int moon_x_pos = pgm_read_byte(&orbit[ORBIT_MOON_X]) - ORBIT_MOON_OFFSET;
+        int moon_y_pos = pgm_read_byte(&orbit[ORBIT_MOON_Y]) - ORBIT_MOON_OFFSET;
+        frame.drawBitmapFast(moon_x_pos, moon_y_pos, bmp_moonWax2qrt_array[index], moon_icon_width, moon_icon_height, foregroundColor);
+        frame.drawBitmapFast(sun_x_pos, sun_y_pos, sunBorderNoRays, sun_icon_width, sun_icon_height, foregroundColor);
     }
+    drawMasks(sun_x_pos, sun_y_pos, sun_icon_width, sun_icon_height);
 }
 
 
-void WatchyChron::drawMasks() {
-    display.drawBitmap(0, 0, backgroundMask, DISPLAY_WIDTH, DISPLAY_HEIGHT, backgroundColor);
-    display.drawBitmap(0, 0, backgroundRing, DISPLAY_WIDTH, DISPLAY_HEIGHT, foregroundColor);
+void WatchyChron::drawMasks(int16_t x, int16_t y, int16_t w, int16_t h) {
+    // Masks are full-screen; only the given window of them is drawn
+    frame.drawPackedBitmapWindow(0, 0, backgroundMaskPacked, DISPLAY_WIDTH, DISPLAY_HEIGHT, backgroundColor, x, y, w, h);
+    frame.drawPackedBitmapWindow(0, 0, backgroundRingPacked, DISPLAY_WIDTH, DISPLAY_HEIGHT, foregroundColor, x, y, w, h);
 }
 
 
 void WatchyChron::drawTime() {
     const uint8_t TIME_POS_X = DISPLAY_CENTRE_X;
     const uint8_t TIME_POS_Y = DISPLAY_CENTRE_Y + 25;
-    display.setFont(&MADE_Sunflower_PERSONAL_USE39pt7b);
-    display.setTextColor(foregroundColor);
-    display.setTextWrap(false);
-    char* timeStr;
-    asprintf(&timeStr, "%d:%02d", currentTime.Hour, currentTime.Minute);
-    drawCenteredString(timeStr, TIME_POS_X, TIME_POS_Y, false);
-    free(timeStr);
+    char timeStr[8]; // fits any uint8_t hour and minute
+    snprintf(timeStr, sizeof(timeStr), "%d:%02d", currentTime.Hour, currentTime.Minute);
+
+    // Centred like drawCenteredString, but measured from the glyph table in time_glyphs.h
+    // and drawn a byte at a time instead of through the 39pt font
+    TimeGlyph glyphs[sizeof(timeStr) - 1];
+    uint8_t count = strlen(timeStr);
+    int16_t minX = INT16_MAX, maxX = INT16_MIN, minY = INT16_MAX, maxY = INT16_MIN;
+    int16_t cursor = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        memcpy_P(&glyphs[i], &timeGlyphs[timeStr[i] - TIME_GLYPH_FIRST], sizeof(TimeGlyph));
+        minX = min(minX, (int16_t)(cursor + glyphs[i].xOffset));
+        maxX = max(maxX, (int16_t)(cursor + glyphs[i].xOffset + glyphs[i].width - 1));
+        minY = min(minY, (int16_t)glyphs[i].yOffset);
+        maxY = max(maxY, (int16_t)(glyphs[i].yOffset + glyphs[i].height - 1));
+        cursor += glyphs[i].xAdvance;
+    }
+    int16_t w = maxX - minX + 1;
+    int16_t h = maxY - minY + 1;
+    dirtyMark(TIME_POS_X + minX - w / 2, TIME_POS_Y + minY, w, h);
+    cursor = TIME_POS_X - w / 2;
+    for (uint8_t i = 0; i < count; i++) {
+        frame.drawBitmapFast(cursor + glyphs[i].xOffset, TIME_POS_Y + glyphs[i].yOffset,
+                             timeGlyphBitmaps + glyphs[i].offset, glyphs[i].width, glyphs[i].height,
+                             foregroundColor);
+        cursor += glyphs[i].xAdvance;
+    }
 }
 
 
-void WatchyChron::drawCenteredString(const String &str, int x, int y, bool drawBg) {
-    int16_t x1, y1;
-    uint16_t w, h;
-    display.getTextBounds(str, x, y, &x1, &y1, &w, &h);
-    display.setCursor(x - w / 2, y);
+void WatchyChron::drawCenteredString(const GFXfont *font, const char *str, int x, int y, bool drawBg) {
+    Rect bounds = measureText(font, str);
+    int16_t w = bounds.w;
+    int16_t h = bounds.h;
+    frame.setFont(font);
+    frame.setCursor(x - w / 2, y);
+    dirtyMark(x + bounds.x - w / 2, y + bounds.y, w, h);
     if(drawBg) {
     int padY = 3;
     int padX = 10;
-    display.fillRect(x - (w / 2 + padX), y - (h + padY), w + padX*2, h + padY*2, backgroundColor);
+    frame.fillRect(x - (w / 2 + padX), y - (h + padY), w + padX*2, h + padY*2, backgroundColor);
+    dirtyMark(x - (w / 2 + padX), y - (h + padY), w + padX*2, h + padY*2);
     }
     // uncomment to draw bounding box
-//          display.drawRect(x - w / 2, y - h, w, h, GxEPD_WHITE);
-    display.print(str);
+//          frame.drawRect(x - w / 2, y - h, w, h, GxEPD_WHITE);
+    frame.print(str);
 }
 
 
@@ -193,23 +365,14 @@ void WatchyChron::drawDate() {
     const uint8_t DATE_POS_X = DISPLAY_CENTRE_X;
     const uint8_t WDAY_POS_Y = DISPLAY_CENTRE_Y + 50;
     const uint8_t DATE_POS_Y = WDAY_POS_Y + 20;
-    int16_t  x1, y1;
-    uint16_t w, h, day_date_offset;
-
-    // Build date string and calculate required offset
-    String dayOfWeek = dayStr(currentTime.Wday);
-    String month = monthShortStr(currentTime.Month);
-    String day = "";
-    if(currentTime.Day < 10){
-        day = "0";
-    }
-    day.concat(currentTime.Day);
-    String year = (String) tmYearToCalendar(currentTime.Year); // Offset from 1970, since year is stored in uint8_t
-    String date = month + " " + day + " " + year;
-    display.setFont(&FreeSansBold9pt7b);
-    display.setTextColor(foregroundColor);
-    drawCenteredString(dayOfWeek, DATE_POS_X, WDAY_POS_Y, false);
-    drawCenteredString(date, DATE_POS_X, DATE_POS_Y, false);
+    char date[16];
+
+    // dayStr and monthShortStr share one static buffer in TimeLib, so draw the weekday first
+    frame.setTextColor(foregroundColor);
+    drawCenteredString(&FreeSansBold9pt7b, dayStr(currentTime.Wday), DATE_POS_X, WDAY_POS_Y, false);
+    snprintf(date, sizeof(date), "%s %02d %d", monthShortStr(currentTime.Month), currentTime.Day,
+             tmYearToCalendar(currentTime.Year)); // Offset from 1970, since year is stored in uint8_t
+    drawCenteredString(&FreeSansBold9pt7b, date, DATE_POS_X, DATE_POS_Y, false);
 }
 
 
@@ -224,11 +387,12 @@ void WatchyChron::drawSteps() {
       sensor.resetStepCounter();
     }
     uint32_t stepCount = sensor.getCounter();
-    display.drawBitmap(STEP_POS_X, STEP_POS_Y, steps, STEP_ICON_WIDTH, STEP_ICON_HEIGHT, foregroundColor);
-    display.setFont(&FreeSansBold9pt7b);
-    display.setTextColor(foregroundColor);
-    display.setCursor(DISPLAY_CENTRE_X + 5, STEP_POS_Y + STEP_ICON_HEIGHT - 5);
-    display.println(stepCount);
+    dirtyMark(STEP_POS_X, STEP_POS_Y, DISPLAY_WIDTH - STEP_POS_X, STEP_ICON_HEIGHT);
+    frame.drawBitmapFast(STEP_POS_X, STEP_POS_Y, steps, STEP_ICON_WIDTH, STEP_ICON_HEIGHT, foregroundColor);
+    frame.setFont(&FreeSansBold9pt7b);
+    frame.setTextColor(foregroundColor);
+    frame.setCursor(DISPLAY_CENTRE_X + 5, STEP_POS_Y + STEP_ICON_HEIGHT - 5);
+    frame.println(stepCount);
 }
 
 
@@ -242,10 +406,11 @@ void WatchyChron::drawBattery() {
     const uint8_t BATT_POS_X = DISPLAY_CENTRE_X - BATTERY_ICON_WIDTH / 2;
     const uint8_t BATT_POS_Y = 20;
 
-    display.drawBitmap(BATT_POS_X, BATT_POS_Y, battery,
-                       BATTERY_ICON_WIDTH, BATTERY_ICON_HEIGHT,
-                       foregroundColor);
-    display.fillRect(BATT_POS_X + 5, BATT_POS_Y + 5,
+    dirtyMark(BATT_POS_X, BATT_POS_Y, BATTERY_ICON_WIDTH, BATTERY_ICON_HEIGHT);
+    frame.drawBitmapFast(BATT_POS_X, BATT_POS_Y, battery,
+                           BATTERY_ICON_WIDTH, BATTERY_ICON_HEIGHT,
+                           foregroundColor);
+    frame.fillRect(BATT_POS_X + 5, BATT_POS_Y + 5,
                      BATTERY_SEG_RECT_WIDTH, BATTERY_SEGMENT_HEIGHT,
                      backgroundColor); //clear battery segments
     int8_t batteryLevel = 0;
@@ -264,309 +429,474 @@ void WatchyChron::drawBattery() {
     }
 
     for(int8_t batterySegments = 0; batterySegments < batteryLevel; batterySegments++){
-        display.fillRect(BATT_POS_X + 5 + (batterySegments * BATTERY_SEGMENT_SPACING), BATT_POS_Y + 5,
+        frame.fillRect(BATT_POS_X + 5 + (batterySegments * BATTERY_SEGMENT_SPACING), BATT_POS_Y + 5,
                          BATTERY_SEGMENT_WIDTH, BATTERY_SEGMENT_HEIGHT,
                          foregroundColor);
     }
 }
 
+const uint8_t buttonPins[BUTTON_COUNT] = {MENU_BTN_PIN, BACK_BTN_PIN, UP_BTN_PIN, DOWN_BTN_PIN};
+// Up/down only move the index; the list is redrawn once the presses stop coming
+bool listPending = false;
+// Rows the current up/down event moves: 1, or a page while a held button is accelerating
+uint8_t listStep = 1;
+const RepeatConfig listRepeat = {REPEAT_DELAY_MS, REPEAT_INTERVAL_MS, REPEAT_PAGE_AFTER};
+
+struct ButtonAction {
+    int8_t state; // WATCHFACE_STATE is -1
+    uint8_t button;
+    void (WatchyChron::*action)();
+};
+
+// What each button does on each screen. Anything not listed is ignored.
+const ButtonAction buttonActions[] = {
+    {WATCHFACE_STATE, BUTTON_MENU, &WatchyChron::openMenu},
+    {WATCHFACE_STATE, BUTTON_BACK, &WatchyChron::toggleDarkMode},
+    {WATCHFACE_STATE, BUTTON_UP,   &WatchyChron::toggleStats},
+    {WATCHFACE_STATE, BUTTON_DOWN, &WatchyChron::toggleTime},
+    {MAIN_MENU_STATE, BUTTON_MENU, &WatchyChron::selectMenuItem},
+    {MAIN_MENU_STATE, BUTTON_BACK, &WatchyChron::exitToWatchFace},
+    {MAIN_MENU_STATE, BUTTON_UP,   &WatchyChron::menuUp},
+    {MAIN_MENU_STATE, BUTTON_DOWN, &WatchyChron::menuDown},
+    {APP_STATE,       BUTTON_BACK, &WatchyChron::openMenu},
+    {FW_UPDATE_STATE, BUTTON_MENU, &WatchyChron::updateFirmware},
+    {FW_UPDATE_STATE, BUTTON_BACK, &WatchyChron::openMenu},
+    {TIMING_STATE,    BUTTON_MENU, &WatchyChron::resetFrameTiming},
+    {TIMING_STATE,    BUTTON_BACK, &WatchyChron::openMenu},
+    {SHOPLIST_STATE,  BUTTON_MENU, &WatchyChron::toggleListItem},
+    {SHOPLIST_STATE,  BUTTON_BACK, &WatchyChron::openMenu},
+    {SHOPLIST_STATE,  BUTTON_UP,   &WatchyChron::listUp},
+    {SHOPLIST_STATE,  BUTTON_DOWN, &WatchyChron::listDown},
+};
+
+// Menu items in menuItems order
+void (WatchyChron::*const menuActions[CHRON_MENU_LENGTH])() = {
+    &WatchyChron::showAbout,
+    &WatchyChron::openShoppingList,
+    &WatchyChron::showAccelerometer,
+    &WatchyChron::setTime,
+    &WatchyChron::setupWifi,
+    &WatchyChron::showUpdateFW,
+    &WatchyChron::showSyncNTP,
+    &WatchyChron::showFrameTiming,
+    &WatchyChron::showSyncList,
+    &WatchyChron::toggleHideChecked,
+};
+
 void WatchyChron::handleButtonPress() {
   uint64_t wakeupBit = esp_sleep_get_ext1_wakeup_status();
-  // Menu Button
-  if (wakeupBit & MENU_BTN_MASK) {
-      if (guiState ==
-          WATCHFACE_STATE) { // enter menu state if coming from watch face
-      showMenu(menuIndex, false);
-      } else if (guiState ==
-              MAIN_MENU_STATE) { // if already in menu, then select menu item
-      switch (menuIndex) {
-      case 0:
-          showAbout();
-          break;
-      case 1:
-          showShoppingList(0, false);
-          break;
-      case 2:
-          showAccelerometer();
-          break;
-      case 3:
-          setTime();
-          break;
-      case 4:
-          setupWifi();
-          break;
-      case 5:
-          showUpdateFW();
-          break;
-      case 6:
-          showSyncNTP();
-          break;
-      default:
-          break;
-      }
-      } else if (guiState == FW_UPDATE_STATE) {
-      updateFWBegin();
-      }
+  inputBegin(buttonPins, DISPLAY_BUSY);
+  listPending = false;
+  InputEvent event = {buttonFromWakeup(wakeupBit, buttonPins), REPEAT_NONE};
+  bool pressed = event.button != BUTTON_NONE;
+  inputPressed(event.button, LIST_REPEAT_BUTTONS, listRepeat);
+  // Stay awake (in light sleep between presses) until back on the watch face, or idle
+  while (pressed || listPending) {
+    if (pressed) {
+      listStep = event.repeat == REPEAT_PAGE ? MENU_LENGTH : 1;
+      dispatchButton(event.button);
+    } else {
+      listPending = false;
+      showPendingList();
+    }
+    if (guiState == WATCHFACE_STATE) {
+      break;
+    }
+    pressed = inputWait(event, listPending ? FAST_BATCH_MS : FAST_MENU_TIMEOUT_MS, LIST_REPEAT_BUTTONS,
+                        listRepeat);
   }
-  // Back Button
-  else if (wakeupBit & BACK_BTN_MASK) {
-      if (guiState == MAIN_MENU_STATE) { // exit to watch face if already in menu
-      RTC.read(currentTime);
-      showWatchFace(false);
-      } else if (guiState == APP_STATE) {
-      showMenu(menuIndex, false); // exit to menu if already in app
-      } else if (guiState == FW_UPDATE_STATE) {
-      showMenu(menuIndex, false); // exit to menu if already in app
-      } else if (guiState == WATCHFACE_STATE) {
-          darkMode = !darkMode;
-          RTC.read(currentTime);
-          showWatchFace(true);
-      } else if (guiState == SHOPLIST_STATE) {
-        showMenu(menuIndex, false); // exit to menu if in shopping list
-      }
+  inputEnd();
+  shoppingListFlush();
+}
+
+void WatchyChron::dispatchButton(uint8_t button) {
+  for (uint8_t i = 0; i < sizeof(buttonActions) / sizeof(buttonActions[0]); i++) {
+    if (buttonActions[i].state == guiState && buttonActions[i].button == button) {
+      (this->*buttonActions[i].action)();
+      return;
+    }
   }
-  // Up Button
-  else if (wakeupBit & UP_BTN_MASK) {
-      if (guiState == MAIN_MENU_STATE) { // increment menu index
-      menuIndex--;
-      if (menuIndex < 0) {
-          menuIndex = MENU_LENGTH - 1;
-      }
-      showMenu(menuIndex, true);
-      } else if (guiState == WATCHFACE_STATE) { // Toggle stats
-          showStats = !showStats;
-          RTC.read(currentTime);
-          showWatchFace(true);
-      } else if (guiState == SHOPLIST_STATE) {  // increment list index (index decr, selection moves up screen)
-        listIndex--;
-        if (listIndex < 0) {
-            listIndex = listLen;
-        }
-        showShoppingList(listIndex, true);
-      }
+}
+
+void WatchyChron::showPendingList() {
+  if (guiState == MAIN_MENU_STATE) {
+    showFastMenu(menuIndex);
+  } else if (guiState == SHOPLIST_STATE) {
+    showShoppingList(listIndex, true);
   }
-  // Down Button
-  else if (wakeupBit & DOWN_BTN_MASK) {
-      if (guiState == MAIN_MENU_STATE) { // decrement menu index
-      menuIndex++;
-      if (menuIndex > MENU_LENGTH - 1) {
-          menuIndex = 0;
-      }
-      showMenu(menuIndex, true);
-      } else if (guiState == WATCHFACE_STATE) { // Toggle time
-          showTime = !showTime;
-          RTC.read(currentTime);
-          showWatchFace(true);
-      } else if (guiState == SHOPLIST_STATE) {  // decrement list index (index incr, selection moves down screen)
-        listIndex++;
-        if (listIndex >= listLen) {
-            listIndex = 0;
-        }
-        showShoppingList(listIndex, true);
-      }
+}
+
+void WatchyChron::openMenu() {
+  listPending = false;
+  showMenu(menuIndex, false);
+}
+
+void WatchyChron::openShoppingList() {
+  listIndex = 0;
+  showShoppingList(0, false);
+}
+
+void WatchyChron::selectMenuItem() {
+  listPending = false;
+  (this->*menuActions[menuIndex])();
+  if (guiState != SHOPLIST_STATE) {
+    reclaimDisplay();
   }
+  // Apps poll the buttons themselves; don't replay their presses afterwards
+  inputFlush();
+}
 
-  /***************** fast menu *****************/
-  bool timeout     = false;
-  long lastTimeout = millis();
-  pinMode(MENU_BTN_PIN, INPUT);
-  pinMode(BACK_BTN_PIN, INPUT);
-  pinMode(UP_BTN_PIN, INPUT);
-  pinMode(DOWN_BTN_PIN, INPUT);
-  while (!timeout) {
-    if (millis() - lastTimeout > 5000) {
-      timeout = true;
-    } else {
-      if (digitalRead(MENU_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState ==
-            MAIN_MENU_STATE) { // if already in menu, then select menu item
-          switch (menuIndex) {
-          case 0:
-            showAbout();
-            break;
-          case 1:
-            showShoppingList(0, false);
-            break;
-          case 2:
-            showAccelerometer();
-            break;
-          case 3:
-            setTime();
-            break;
-          case 4:
-            setupWifi();
-            break;
-          case 5:
-            showUpdateFW();
-            break;
-          case 6:
-            showSyncNTP();
-            break;
-          default:
-            break;
-          }
-        } else if (guiState == FW_UPDATE_STATE) {
-          updateFWBegin();
-        }
-      } else if (digitalRead(BACK_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // exit to watch face if already in menu
-          RTC.read(currentTime);
-          showWatchFace(false);
-          break; // leave loop
-        } else if (guiState == APP_STATE) {
-          showMenu(menuIndex, false); // exit to menu if already in app
-        } else if (guiState == FW_UPDATE_STATE) {
-          showMenu(menuIndex, false); // exit to menu if already in app
-        } else if (guiState == WATCHFACE_STATE) {
-          timeout = true;
-        } else if (guiState == SHOPLIST_STATE) {
-          showMenu(menuIndex, false); // exit to menu if in shopping list
-        }
-      } else if (digitalRead(UP_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // increment menu index
-          menuIndex--;
-          if (menuIndex < 0) {
-            menuIndex = MENU_LENGTH - 1;
-          }
-          showFastMenu(menuIndex);
-        } else if (guiState == WATCHFACE_STATE) {
-            timeout = true;
-        } else if (guiState == SHOPLIST_STATE) {  // increment list index (index decr, selection moves up screen)
-          listIndex--;
-          if (listIndex < 0) {
-              listIndex = listLen;
-          }
-          showShoppingList(listIndex, true);
-        }
-      } else if (digitalRead(DOWN_BTN_PIN) == 1) {
-        lastTimeout = millis();
-        if (guiState == MAIN_MENU_STATE) { // decrement menu index
-          menuIndex++;
-          if (menuIndex > MENU_LENGTH - 1) {
-            menuIndex = 0;
-          }
-          showFastMenu(menuIndex);
-        } else if (guiState == WATCHFACE_STATE) {
-            timeout = true;
-        } else if (guiState == SHOPLIST_STATE) {  // increment list index (index decr, selection moves up screen)
-          listIndex--;
-          if (listIndex < 0) {
-            listIndex = listLen;
-          }
-          showShoppingList(listIndex, true);
-        }
-      }
-    }
+void WatchyChron::updateFirmware() {
+  updateFWBegin();
+  reclaimDisplay();
+}
+
+void WatchyChron::reclaimDisplay() {
+  // Library screens draw on the display themselves, and some (setTime, showAccelerometer)
+  // finish on the library's own menu, which lists different items
+  listViewInvalidate();
+  if (guiState == MAIN_MENU_STATE) {
+    showMenu(menuIndex, false);
   }
 }
 
-void WatchyChron::showMenu(byte menuIndex, bool partialRefresh) {
-  display.setFullWindow();
-  display.fillScreen(GxEPD_BLACK);
-  display.setFont(&FreeMonoBold9pt7b);
-
-  int16_t x1, y1;
-  uint16_t w, h;
-  int16_t yPos;
-
-  const char *menuItems[] = {
-      "About Watchy", "Shopping List", "Show Accelerometer",
-      "Set Time",     "Setup WiFi",    "Update Firmware",
-      "Sync NTP"};
-  for (int i = 0; i < MENU_LENGTH; i++) {
-    yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
-    display.setCursor(0, yPos);
-    if (i == menuIndex) {
-      display.getTextBounds(menuItems[i], 0, yPos, &x1, &y1, &w, &h);
-      display.fillRect(x1 - 1, y1 - 10, 200, h + 15, GxEPD_WHITE);
-      display.setTextColor(GxEPD_BLACK);
-      display.println(menuItems[i]);
-    } else {
-      display.setTextColor(GxEPD_WHITE);
-      display.println(menuItems[i]);
+void WatchyChron::exitToWatchFace() {
+  listPending = false;
+  RTC.read(currentTime);
+  showWatchFace(false);
+}
+
+void WatchyChron::toggleDarkMode() {
+  darkMode = !darkMode;
+  // Every pixel of the face is one of the two colours, so the cached background, arc and
+  // masks are still valid once inverted
+  staticLayerInvert(1 << DARK_MODE_KEY_BIT);
+  RTC.read(currentTime);
+  showWatchFace(true);
+}
+
+void WatchyChron::toggleStats() {
+  showStats = !showStats;
+  RTC.read(currentTime);
+  showWatchFace(true);
+}
+
+void WatchyChron::toggleTime() {
+  showTime = !showTime;
+  RTC.read(currentTime);
+  showWatchFace(true);
+}
+
+int stepIndex(int index, int step, int length) {
+  // Single steps wrap around; page steps stop at the ends first
+  if (step == 1 || step == -1) {
+    return (index + step + length) % length;
+  }
+  int next = index + step;
+  if (next < 0) {
+    return index == 0 ? length - 1 : 0;
+  }
+  if (next >= length) {
+    return index == length - 1 ? 0 : length - 1;
+  }
+  return next;
+}
+
+void WatchyChron::menuUp() {
+  menuIndex = stepIndex(menuIndex, -listStep, CHRON_MENU_LENGTH);
+  listPending = true;
+}
+
+void WatchyChron::menuDown() {
+  menuIndex = stepIndex(menuIndex, listStep, CHRON_MENU_LENGTH);
+  listPending = true;
+}
+
+uint16_t shoppingViewLength() {
+  return hideChecked ? shoppingListRemaining() : shoppingListLength();
+}
+
+uint16_t shoppingItemAt(uint16_t row) {
+  // With checked items hidden, row n is the n-th unchecked item
+  return hideChecked ? shoppingListUnchecked(row) : row;
+}
+
+void WatchyChron::listUp() { // selection moves up screen
+  if (shoppingViewLength() == 0) {
+    return;
+  }
+  listIndex = stepIndex(listIndex, -listStep, shoppingViewLength());
+  listPending = true;
+}
+
+void WatchyChron::listDown() { // selection moves down screen
+  if (shoppingViewLength() == 0) {
+    return;
+  }
+  listIndex = stepIndex(listIndex, listStep, shoppingViewLength());
+  listPending = true;
+}
+
+void WatchyChron::toggleListItem() {
+  // Only RTC memory changes here; the marks reach flash when the menus go back to sleep, or
+  // early once SHOPPING_PENDING_TOGGLES have piled up
+  if (listIndex >= shoppingViewLength()) {
+    return;
+  }
+  shoppingListToggle(shoppingItemAt(listIndex));
+  if (hideChecked) {
+    // The item drops out and the rows below move up
+    listViewChanged();
+    if (listIndex > 0 && listIndex >= shoppingViewLength()) {
+      listIndex--;
     }
   }
+  listPending = true;
+}
 
-  display.display(partialRefresh);
+void WatchyChron::toggleHideChecked() {
+  hideChecked = !hideChecked;
+  openShoppingList();
+}
+
+const char *menuItemText(uint16_t index) {
+    if (index == CHRON_MENU_LENGTH - 1 && hideChecked) {
+        return "Show Checked";
+    }
+    return menuItems[index];
+}
+
+const char *listItemText(uint16_t index) {
+    return shoppingListItem(shoppingItemAt(index));
+}
 
+bool listItemChecked(uint16_t index) {
+    return shoppingListChecked(shoppingItemAt(index));
+}
+
+const ListView mainMenu = {0, menuItemText, nullptr, CHRON_MENU_LENGTH, MENU_LENGTH, MENU_HEIGHT, nullptr};
+ListView shoppingList = {1, listItemText, listItemChecked, 0, MENU_LENGTH, MENU_HEIGHT, nullptr};
+char shoppingBadge[16];
+
+void WatchyChron::showMenu(byte menuIndex, bool partialRefresh) {
+  showList(mainMenu, menuIndex, partialRefresh);
   guiState = MAIN_MENU_STATE;
   alreadyInMenu = false;
 }
 
 void WatchyChron::showFastMenu(byte menuIndex) {
-  display.setFullWindow();
-  display.fillScreen(GxEPD_BLACK);
-  display.setFont(&FreeMonoBold9pt7b);
-
-  int16_t x1, y1;
-  uint16_t w, h;
-  int16_t yPos;
-
-  const char *menuItems[] = {
-      "About Watchy", "Shopping List", "Show Accelerometer",
-      "Set Time",     "Setup WiFi",    "Update Firmware",
-      "Sync NTP"};
-  for (int i = 0; i < MENU_LENGTH; i++) {
-    yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
+  showList(mainMenu, menuIndex, true);
+  guiState = MAIN_MENU_STATE;
+}
+
+void WatchyChron::showShoppingList(uint16_t listIndex, bool partialRefresh) {
+    if (shoppingListBegin()) {
+        snprintf(shoppingBadge, sizeof(shoppingBadge), "%u left", shoppingListRemaining());
+    } else {
+        snprintf(shoppingBadge, sizeof(shoppingBadge), "Storage error");
+    }
+    shoppingList.length = shoppingViewLength();
+    shoppingList.footer = shoppingBadge;
+    showList(shoppingList, listIndex, partialRefresh);
+    guiState = SHOPLIST_STATE;
+    // Prevent exiting to watchface when in shopping list
+    alreadyInMenu = false;
+}
+
+void WatchyChron::drawListRow(const ListView &list, uint16_t top, int16_t row, uint16_t selected) {
+    uint16_t i = top + row;
+    Rect band = listRowBand(list, row, DISPLAY_WIDTH);
+    bool highlighted = i == selected;
+    uint16_t textColor = highlighted ? GxEPD_BLACK : GxEPD_WHITE;
+    display.fillRect(band.x, band.y, band.w, band.h, highlighted ? GxEPD_WHITE : GxEPD_BLACK);
+    if (i >= list.length) {
+        return;
+    }
+    int16_t yPos = listRowBaseline(list, row);
     display.setCursor(0, yPos);
-    if (i == menuIndex) {
-      display.getTextBounds(menuItems[i], 0, yPos, &x1, &y1, &w, &h);
-      display.fillRect(x1 - 1, y1 - 10, 200, h + 15, GxEPD_WHITE);
-      display.setTextColor(GxEPD_BLACK);
-      display.println(menuItems[i]);
+    display.setTextColor(textColor);
+    display.print(list.itemText(i));
+    if (list.itemChecked && list.itemChecked(i)) {
+        display.drawLine(0, yPos - 5, DISPLAY_WIDTH, yPos - 5, textColor);
+    }
+}
+
+void WatchyChron::showList(const ListView &list, uint16_t selected, bool partialRefresh) {
+    ListViewPlan plan = listViewPlan(list, selected, partialRefresh);
+    display.setFullWindow();
+    display.setFont(&FreeMonoBold9pt7b);
+    Rect footer = listFooterBand(list, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    if (plan.drawPage) {
+        display.fillScreen(GxEPD_BLACK);
+        for (int16_t row = 0; row < list.rows && plan.top + row < list.length; row++) {
+            drawListRow(list, plan.top, row, selected);
+        }
     } else {
-      display.setTextColor(GxEPD_WHITE);
-      display.println(menuItems[i]);
+        for (uint8_t n = 0; n < 2; n++) {
+            if (plan.rows[n] >= 0) {
+                drawListRow(list, plan.top, plan.rows[n], selected);
+            }
+        }
+    }
+    if (plan.footer) {
+        display.fillRect(footer.x, footer.y, footer.w, footer.h, GxEPD_BLACK);
+        if (list.footer) {
+            Rect bounds = measureText(&FreeMonoBold9pt7b, list.footer);
+            display.setTextColor(GxEPD_WHITE);
+            display.setCursor(DISPLAY_WIDTH - bounds.w - bounds.x - 2, DISPLAY_HEIGHT - 4);
+            display.print(list.footer);
+        }
     }
-  }
 
-  display.display(true);
+    if (plan.fullPage) {
+        // Paged up or down, or coming from another screen: do a full refresh
+        display.display(false);
+        timingPanelPush(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+        return;
+    }
+    // Same page: usually only the old and new highlighted rows changed
+    Rect dirty = Rect{0, 0, 0, 0};
+    if (plan.pushPage) {
+        dirty = rectUnion(listRowBand(list, 0, DISPLAY_WIDTH), listRowBand(list, list.rows - 1, DISPLAY_WIDTH));
+    }
+    for (uint8_t n = 0; n < 2; n++) {
+        if (plan.rows[n] >= 0) {
+            dirty = rectUnion(dirty, listRowBand(list, plan.rows[n], DISPLAY_WIDTH));
+        }
+    }
+    if (plan.footer) {
+        dirty = rectUnion(dirty, footer);
+    }
+    if (rectIsEmpty(dirty)) {
+        return;
+    }
+    dirty = rectClip(dirty, DISPLAY_WIDTH, DISPLAY_HEIGHT);
+    display.displayWindow(dirty.x, dirty.y, dirty.w, dirty.h);
+    timingPanelPush(dirty.w, dirty.h);
+}
 
-  guiState = MAIN_MENU_STATE;
+
+void WatchyChron::showFrameTiming() {
+    // FreeMonoBold9pt7b is 11 px a character, so a row fits 18: the average and max columns.
+    // Rows are closer than the font's line height to leave room for the hint at the bottom.
+    const int16_t ROW_HEIGHT = 16;
+    const int16_t FIRST_BASELINE = 14;
+    display.setFullWindow();
+    display.fillScreen(GxEPD_BLACK);
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_WHITE);
+    display.setCursor(0, FIRST_BASELINE);
+    display.print("ms      avg    max");
+
+    char line[20];
+    for (uint8_t i = 0; i < STAGE_COUNT; i++) {
+        StageStats stats = timingStats((FrameStage)i);
+        snprintf(line, sizeof(line), "%-4s%7.1f%7.1f", timingStageName((FrameStage)i),
+                 stats.mean / 1000.0, stats.max / 1000.0);
+        display.setCursor(0, FIRST_BASELINE + (i + 1) * ROW_HEIGHT);
+        display.print(line);
+    }
+    display.setCursor(0, FIRST_BASELINE + (STAGE_COUNT + 1) * ROW_HEIGHT);
+    display.print("MENU to reset");
+    display.display(false);
+
+    // Same numbers in microseconds, with min and the panel byte counts, for anyone on serial
+    Serial.begin(115200);
+    writeFrameTiming(Serial);
+    Serial.flush();
+
+    guiState = TIMING_STATE;
+}
+
+
+void WatchyChron::resetFrameTiming() {
+    timingReset();
+    showFrameTiming();
 }
 
-// TODO: showMenu, showShoppingList, showFastMenu, and showShoppingList are near-identical:
-    // Investigate consolidating code into fn/wrappers
-void WatchyChron::showShoppingList(byte listIndex, bool partialRefresh) {
-    static uint16_t lastListSttIndex = 0;
+
+void WatchyChron::showSyncList() {
+    guiState = APP_STATE;
     display.setFullWindow();
     display.fillScreen(GxEPD_BLACK);
     display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_WHITE);
+    display.setCursor(0, 30);
+    display.println("Sync List");
+    // Storage first: there is no point in turning the radio on for a list that can't be written
+    if (!shoppingListBegin()) {
+        display.println("Storage error");
+        display.display(false);
+        return;
+    }
+    if (!connectWiFi()) {
+        display.println("No WiFi, try");
+        display.println("Setup WiFi first");
+        display.display(false);
+        WiFi.mode(WIFI_OFF);
+        return;
+    }
 
-    int16_t x1, y1;
-    uint16_t w, h;
-    int16_t yPos;
-
-    const uint8_t maxItemLen = 18; // max chars in item not including null char
-    // const uint8_t maxItemLenExclCheckbox = 15; // assuming two-char checkbox plus space
-    const uint16_t listSttIndex = (listIndex / MENU_LENGTH) * MENU_LENGTH;
-    if (listSttIndex != lastListSttIndex) {
-        // Paged up or down: do a full refresh
-        partialRefresh = false;
-    }
-    lastListSttIndex = listSttIndex;
-
-    for (int i = listSttIndex; i < listSttIndex + MENU_LENGTH && i < listLen; i++) {
-        yPos = MENU_HEIGHT + (MENU_HEIGHT * i);
-        display.setCursor(0, yPos);
-        if (i == listIndex) {
-            display.getTextBounds(listItems[i], 0, yPos, &x1, &y1, &w, &h);
-            display.fillRect(x1 - 1, y1 - 10, 200, h + 15, GxEPD_WHITE); // 200 might just be display width
-            display.setTextColor(GxEPD_BLACK);
-            display.println(listItems[i]);
-        } else {
-            display.setTextColor(GxEPD_WHITE);
-            display.println(listItems[i]);
+    WebServer server(SYNC_PORT);
+    bool synced = false;
+    // GET /list: hash of the current list, then one item per line
+    server.on("/list", HTTP_GET, [&]() {
+        char line[SHOPPING_ITEM_MAX_LEN + 2];
+        server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        snprintf(line, sizeof(line), "%08x\n", shoppingListHash());
+        server.send(200, "text/plain", line);
+        for (uint16_t i = 0; i < shoppingListLength(); i++) {
+            snprintf(line, sizeof(line), "%s\n", shoppingListItem(i));
+            server.sendContent(line);
+        }
+        server.sendContent("");
+    });
+    // POST /list: an edit script, see shoppingListApply()
+    server.on("/list", HTTP_POST, [&]() {
+        String script = server.arg("plain");
+        switch (shoppingListApply(script.c_str(), script.length())) {
+        case SYNC_OK:
+            synced = true;
+            server.send(200, "text/plain", String(shoppingListLength()) + " items\n");
+            break;
+        case SYNC_STALE:
+            server.send(409, "text/plain", "list changed, fetch it again\n");
+            break;
+        case SYNC_BAD_SCRIPT:
+            server.send(400, "text/plain", "bad script\n");
+            break;
+        default:
+            server.send(500, "text/plain", "write failed\n");
+            break;
         }
-        if (listChecks[i]) {
-            display.drawLine(x1 - 1, y1 + h/2, 200, y1 + h/2, i == listIndex ? GxEPD_BLACK : GxEPD_WHITE);
+    });
+    server.begin();
+    display.println(WiFi.localIP().toString());
+    display.println("BACK to cancel");
+    display.display(true);
+
+    uint32_t start = millis();
+    InputEvent event;
+    while (!synced && millis() - start < SYNC_TIMEOUT_MS) {
+        server.handleClient();
+        if (inputPoll(event) && event.button == BUTTON_BACK) {
+            break;
         }
+        delay(2);
     }
-    display.display(partialRefresh);
-    guiState = SHOPLIST_STATE;
-    // Prevent exiting to watchface when in shopping list
-    alreadyInMenu = false;
+    server.stop();
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+
+    display.fillScreen(GxEPD_BLACK);
+    display.setCursor(0, 30);
+    display.println("Sync List");
+    if (synced) {
+        display.print(shoppingListLength());
+        display.println(" items");
+        listIndex = 0;
+    } else {
+        display.println("Nothing received");
+    }
+    display.display(true);
 }
@@ -2,32 +2,68 @@
 #define WATCHY_CHRON_H
 
 #include <Watchy.h>
-#include "Seven_Segment10pt7b.h"
-#include "DSEG7_Classic_Regular_15.h"
-#include "DSEG7_Classic_Bold_25.h"
-#include "DSEG7_Classic_Regular_39.h"
 #include <Fonts/FreeSansBold9pt7b.h>
-#include "MadeSunflower39pt7b.h"
 #include "lookups.h"
+#include "frame_buffer.h"
+#include "frame_timing.h"
+#include "dirty_region.h"
+#include "text_measure.h"
+#include "static_layer.h"
+#include "solar.h"
+#include "list_view.h"
+#include "input_events.h"
+#include "shopping_list.h"
 
 #define SHOPLIST_STATE 10 // Start custom states from 10 to allow room for official updates
+#define TIMING_STATE 11
+#define CHRON_MENU_LENGTH 10 // Watchy's MENU_LENGTH items per page, plus our own
 
 class WatchyChron : public Watchy{
     using Watchy::Watchy;
     public:
+        static FrameBuffer frame;
+        void init(String datetime = "");
+        void showWatchFace(bool partialRefresh);
         void drawWatchFace();
+        void setLocation(float latitude, float longitude);
+        void updateDayNight();
+        void renderFace();
+        void presentFrame(const Rect &window);
+        void renderSweep(Print &out, uint16_t firstDay, uint16_t lastDay, uint16_t minuteStep);
         void drawBattery();
         void drawDate();
         void drawDayNight();
-        void drawMasks();
+        void drawMasks(int16_t x, int16_t y, int16_t w, int16_t h);
         void drawSteps();
         void drawSun();
-        void showShoppingList(byte listIndex, bool partialRefresh);
+        void showShoppingList(uint16_t listIndex, bool partialRefresh);
         void drawTime();
-        void drawCenteredString(const String &str, int x, int y, bool drawBg);
+        void drawCenteredString(const GFXfont *font, const char *str, int x, int y, bool drawBg);
         void handleButtonPress();
+        void dispatchButton(uint8_t button);
+        void showPendingList();
+        void openMenu();
+        void openShoppingList();
+        void selectMenuItem();
+        void updateFirmware();
+        void reclaimDisplay();
+        void exitToWatchFace();
+        void toggleDarkMode();
+        void toggleStats();
+        void toggleTime();
+        void menuUp();
+        void menuDown();
+        void listUp();
+        void listDown();
+        void toggleListItem();
+        void toggleHideChecked();
         void showMenu(byte menuIndex, bool partialRefresh);
         void showFastMenu(byte menuIndex);
+        void showList(const ListView &list, uint16_t selected, bool partialRefresh);
+        void drawListRow(const ListView &list, uint16_t top, int16_t row, uint16_t selected);
+        void showFrameTiming();
+        void resetFrameTiming();
+        void showSyncList();
 };
 
 extern RTC_DATA_ATTR bool showTime;
@@ -3,7 +3,16 @@
 WatchyChron watchy(settings);
 
 void setup(){
+#ifdef LATITUDE
+  watchy.setLocation(LATITUDE, LONGITUDE);
+#endif
+#ifdef RENDER_SWEEP
+  // Headless render: dump faces over serial as PBM instead of running the watch
+  Serial.begin(RENDER_SWEEP_BAUD);
+  watchy.renderSweep(Serial, RENDER_SWEEP_FIRST_DAY, RENDER_SWEEP_LAST_DAY, RENDER_SWEEP_MINUTE_STEP);
+#else
   watchy.init();
+#endif
 }
 
 void loop(){}
@@ -0,0 +1,44 @@
+#include "button_repeat.h"
+
+bool IRAM_ATTR debounceChange(Debouncer &d, bool level, uint32_t nowMs, uint16_t debounceMs) {
+    if (level == d.stable || nowMs - d.lastChangeMs < debounceMs) {
+        return false;
+    }
+    d.stable = level;
+    d.lastChangeMs = nowMs;
+    return level;
+}
+
+void repeatStart(AutoRepeat &r, uint32_t nowMs, const RepeatConfig &config) {
+    r.active = true;
+    r.nextMs = nowMs + config.delayMs;
+    r.count = 0;
+}
+
+void repeatStop(AutoRepeat &r) {
+    r.active = false;
+}
+
+uint8_t repeatPoll(AutoRepeat &r, uint32_t nowMs, const RepeatConfig &config) {
+    if (!r.active || (int32_t)(nowMs - r.nextMs) < 0) {
+        return REPEAT_NONE;
+    }
+    // Schedule from the due time, not from now, so a late poll doesn't slow the rate
+    r.nextMs += config.intervalMs;
+    if ((int32_t)(nowMs - r.nextMs) >= 0) {
+        r.nextMs = nowMs + config.intervalMs;
+    }
+    r.count++;
+    if (config.pageAfter && r.count > config.pageAfter) {
+        return REPEAT_PAGE;
+    }
+    return REPEAT_STEP;
+}
+
+uint32_t repeatWaitMs(const AutoRepeat &r, uint32_t nowMs) {
+    if (!r.active) {
+        return UINT32_MAX;
+    }
+    int32_t wait = (int32_t)(r.nextMs - nowMs);
+    return wait > 0 ? wait : 0;
+}
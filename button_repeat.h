@@ -0,0 +1,43 @@
+#ifndef BUTTON_REPEAT_H
+#define BUTTON_REPEAT_H
+
+#include <Arduino.h>
+
+#ifndef IRAM_ATTR
+#define IRAM_ATTR
+#endif
+
+// Timing-only button logic, kept free of GPIO so it can be fed recorded timelines.
+
+// Accepts a level change only if the last accepted one is more than debounceMs old
+struct Debouncer {
+    bool stable;
+    uint32_t lastChangeMs;
+};
+
+// Feed the raw level after an edge (or any time). Returns true for a new press.
+bool debounceChange(Debouncer &d, bool level, uint32_t nowMs, uint16_t debounceMs);
+
+struct RepeatConfig {
+    uint16_t delayMs;    // hold this long before the first repeat
+    uint16_t intervalMs; // then repeat this often
+    uint8_t pageAfter;   // after this many repeats, each one skips a page (0 = never)
+};
+
+struct AutoRepeat {
+    bool active;
+    uint32_t nextMs;
+    uint16_t count;
+};
+
+// What a repeat asks for
+#define REPEAT_NONE 0
+#define REPEAT_STEP 1
+#define REPEAT_PAGE 2
+
+void repeatStart(AutoRepeat &r, uint32_t nowMs, const RepeatConfig &config);
+void repeatStop(AutoRepeat &r);
+uint8_t repeatPoll(AutoRepeat &r, uint32_t nowMs, const RepeatConfig &config);
+uint32_t repeatWaitMs(const AutoRepeat &r, uint32_t nowMs);
+
+#endif
@@ -0,0 +1,69 @@
+#include "dirty_region.h"
+
+RTC_DATA_ATTR Rect prevMovingRect;
+RTC_DATA_ATTR uint32_t prevLayoutKey;
+RTC_DATA_ATTR bool prevFrameValid = false;
+Rect currMovingRect;
+uint32_t currLayoutKey;
+
+bool rectIsEmpty(const Rect &r) {
+    return r.w <= 0 || r.h <= 0;
+}
+
+Rect rectUnion(const Rect &a, const Rect &b) {
+    if (rectIsEmpty(a)) {
+        return b;
+    }
+    if (rectIsEmpty(b)) {
+        return a;
+    }
+    int16_t x0 = min(a.x, b.x);
+    int16_t y0 = min(a.y, b.y);
+    int16_t x1 = max(a.x + a.w, b.x + b.w);
+    int16_t y1 = max(a.y + a.h, b.y + b.h);
+    return Rect{x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+Rect rectClip(const Rect &r, int16_t width, int16_t height) {
+    int16_t x0 = max(r.x, (int16_t)0);
+    int16_t y0 = max(r.y, (int16_t)0);
+    int16_t x1 = min((int16_t)(r.x + r.w), width);
+    int16_t y1 = min((int16_t)(r.y + r.h), height);
+    if (x1 <= x0 || y1 <= y0) {
+        return Rect{0, 0, 0, 0};
+    }
+    return Rect{x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)};
+}
+
+Rect rectAlignX8(const Rect &r) {
+    // The panel controller addresses RAM a byte (8 pixels) at a time horizontally
+    int16_t x0 = r.x & ~7;
+    int16_t x1 = (r.x + r.w + 7) & ~7;
+    return Rect{x0, r.y, (int16_t)(x1 - x0), r.h};
+}
+
+void dirtyBeginFrame(uint32_t layoutKey) {
+    currMovingRect = Rect{0, 0, 0, 0};
+    currLayoutKey = layoutKey;
+}
+
+void dirtyMark(int16_t x, int16_t y, int16_t w, int16_t h) {
+    currMovingRect = rectUnion(currMovingRect, Rect{x, y, w, h});
+}
+
+Rect dirtyEndFrame(int16_t width, int16_t height) {
+    Rect dirty;
+    if (!prevFrameValid || currLayoutKey != prevLayoutKey) {
+        dirty = Rect{0, 0, width, height};
+    } else {
+        dirty = rectAlignX8(rectClip(rectUnion(prevMovingRect, currMovingRect), width, height));
+    }
+    prevMovingRect = currMovingRect;
+    prevLayoutKey = currLayoutKey;
+    prevFrameValid = true;
+    return dirty;
+}
+
+void dirtyInvalidate() {
+    prevFrameValid = false;
+}
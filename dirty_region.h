@@ -0,0 +1,32 @@
+#ifndef DIRTY_REGION_H
+#define DIRTY_REGION_H
+
+#include <Arduino.h>
+
+#ifndef RTC_DATA_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+struct Rect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+bool rectIsEmpty(const Rect &r);
+Rect rectUnion(const Rect &a, const Rect &b);
+Rect rectClip(const Rect &r, int16_t width, int16_t height);
+Rect rectAlignX8(const Rect &r);
+
+// Tracks the parts of the face that move between frames (sun/moon, text, stats).
+// The previous frame's moving region is kept in RTC memory, so after a deep sleep the
+// region to push is the union of where things were and where they are now.
+// Anything static (day/night arc, masks, colours) is summarised by a layout key;
+// when that changes, or the panel showed something else, the whole screen is dirty.
+void dirtyBeginFrame(uint32_t layoutKey);
+void dirtyMark(int16_t x, int16_t y, int16_t w, int16_t h);
+Rect dirtyEndFrame(int16_t width, int16_t height);
+void dirtyInvalidate();
+
+#endif
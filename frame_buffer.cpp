@@ -0,0 +1,205 @@
+#include "frame_buffer.h"
+
+void FrameBuffer::drawBitmapFast(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                                 uint16_t color) {
+    // Same as drawBitmap (PROGMEM, rows padded to bytes, set bits only), a byte at a time at any x
+    const int16_t byteWidth = (w + 7) / 8;
+    const int16_t xMax = min((int16_t)(x + w), (int16_t)WIDTH);
+    for (int16_t j = max(y, (int16_t)0); j < min((int16_t)(y + h), (int16_t)HEIGHT); j++) {
+        const uint8_t *row = bitmap + (j - y) * byteWidth;
+        for (int16_t i = 0; i < byteWidth; i++) {
+            uint8_t bits = pgm_read_byte(&row[i]);
+            if (bits) {
+                drawBitmapByte(x + i * 8, j, bits, color, 0, xMax);
+            }
+        }
+    }
+}
+
+void FrameBuffer::fillCrescent(int16_t x0, int16_t y0, int16_t maskY0, int32_t r, uint16_t color) {
+    // Same pixels as fillCircle(x0, y0, r, color) followed by fillCircle(x0, maskY0, r, background)
+    // on a frame that is already background, but only the crescent between them is written.
+    // Both circles have the same radius, so one table of column half-heights serves both; it is
+    // filled by Adafruit's midpoint walk (in 32 bits, so large radii don't overflow) and stops at
+    // the last column on screen.
+    int32_t maxDx = max(x0, (int16_t)(WIDTH - 1 - x0));
+    maxDx = min(min(maxDx, r), (int32_t)CRESCENT_MAX_COLUMNS - 1);
+    if (maxDx < 0) {
+        return;
+    }
+    int32_t half[CRESCENT_MAX_COLUMNS];
+    for (int32_t dx = 0; dx <= maxDx; dx++) {
+        half[dx] = -1;
+    }
+    half[0] = r;
+    int32_t f = 1 - r;
+    int32_t ddFx = 1;
+    int32_t ddFy = -2 * r;
+    int32_t x = 0;
+    int32_t y = r;
+    int32_t px = x;
+    int32_t py = y;
+    while (x < y && x <= maxDx) {
+        if (f >= 0) {
+            y--;
+            ddFy += 2;
+            f += ddFy;
+        }
+        x++;
+        ddFx += 2;
+        f += ddFx;
+        if (x < y + 1 && x <= maxDx) {
+            half[x] = max(half[x], y);
+        }
+        if (y != py) {
+            if (py <= maxDx) {
+                half[py] = max(half[py], px);
+            }
+            py = y;
+        }
+        px = x;
+    }
+    const int16_t firstCol = max((int32_t)0, x0 - maxDx);
+    const int16_t lastCol = min((int32_t)WIDTH - 1, x0 + maxDx);
+    for (int16_t col = firstCol; col <= lastCol; col++) {
+        const int32_t h = half[abs(col - x0)];
+        if (h < 0) {
+            continue;
+        }
+        int32_t top = y0 - h;
+        int32_t bottom = y0 + h;
+        if (maskY0 > y0) {
+            bottom = min(bottom, (int32_t)maskY0 - h - 1);
+        } else if (maskY0 < y0) {
+            top = max(top, (int32_t)maskY0 + h + 1);
+        } else {
+            continue;
+        }
+        top = max(top, (int32_t)0);
+        bottom = min(bottom, (int32_t)HEIGHT - 1);
+        if (top <= bottom) {
+            drawFastVLine(col, top, bottom - top + 1, color);
+        }
+    }
+}
+
+void FrameBuffer::drawPackedBitmapWindow(int16_t x, int16_t y, const uint8_t packed[], int16_t w, int16_t h,
+                                         uint16_t color, int16_t wx, int16_t wy, int16_t ww, int16_t wh) {
+    // Decodes PackBits (see tools/packbits.py) straight from flash into the frame, one byte at a time,
+    // and stops as soon as the last row inside the window is done
+    const int16_t byteWidth = (w + 7) / 8;
+    const int16_t xMin = max((int16_t)max(x, wx), (int16_t)0);
+    const int16_t xMax = min((int16_t)min((int16_t)(x + w), (int16_t)(wx + ww)), (int16_t)WIDTH);
+    const int16_t yMin = max((int16_t)max(y, wy), (int16_t)0);
+    const int16_t yMax = min((int16_t)min((int16_t)(y + h), (int16_t)(wy + wh)), (int16_t)HEIGHT);
+    if (xMin >= xMax || yMin >= yMax) {
+        return;
+    }
+    int16_t row = y;
+    int16_t col = 0;
+    while (row < yMax) {
+        uint8_t n = pgm_read_byte(packed++);
+        int16_t count;
+        bool repeat = n > 128;
+        if (n < 128) {
+            count = n + 1;
+        } else if (repeat) {
+            count = 257 - n;
+        } else {
+            continue; // 128 is a no-op
+        }
+        uint8_t value = repeat ? pgm_read_byte(packed++) : 0;
+        while (count-- > 0 && row < yMax) {
+            if (!repeat) {
+                value = pgm_read_byte(packed++);
+            }
+            if (row >= yMin && value) {
+                drawBitmapByte(x + col * 8, row, value, color, xMin, xMax);
+            }
+            if (++col == byteWidth) {
+                col = 0;
+                row++;
+            }
+        }
+    }
+}
+
+void FrameBuffer::drawBitmapByte(int16_t x, int16_t y, uint8_t bits, uint16_t color,
+                                 int16_t xMin, int16_t xMax) {
+    // Draw the set bits of one bitmap byte whose first pixel is at x, clipped to [xMin, xMax)
+    if (x < xMin) {
+        bits &= (xMin - x >= 8) ? 0 : 0xFF >> (xMin - x);
+    }
+    if (x + 8 > xMax) {
+        bits &= (x + 8 - xMax >= 8) ? 0 : 0xFF << (x + 8 - xMax);
+    }
+    if (!bits) {
+        return;
+    }
+    if (getRotation() == 0) {
+        // Straight into the buffer: the byte lands on one frame byte, or straddles two when
+        // x isn't a multiple of 8. Clipping above keeps the second half inside the row.
+        uint8_t *dest = getBuffer() + y * bytesPerRow() + (x >> 3);
+        const uint8_t shift = x & 7;
+        const uint8_t left = bits >> shift;
+        const uint8_t right = shift ? (uint8_t)(bits << (8 - shift)) : 0;
+        if (left) {
+            dest[0] = color ? dest[0] | left : dest[0] & ~left;
+        }
+        if (right) {
+            dest[1] = color ? dest[1] | right : dest[1] & ~right;
+        }
+        return;
+    }
+    for (uint8_t i = 0; i < 8; i++) {
+        if (bits & (0x80 >> i)) {
+            drawPixel(x + i, y, color);
+        }
+    }
+}
+
+static inline uint32_t rasterWord(uint32_t dest, uint32_t src, RasterOp op) {
+    switch (op) {
+        case ROP_AND:
+            return dest & src;
+        case ROP_OR:
+            return dest | src;
+        case ROP_XOR:
+            return dest ^ src;
+        default:
+            return dest & ~src;
+    }
+}
+
+void rasterOp(uint8_t *dest, const uint8_t *src, uint16_t size, RasterOp op) {
+    // 32 bits at a time, then the odd bytes one by one. Words go through memcpy, which compiles
+    // to plain loads and stores but doesn't alias the byte buffers. Bit order doesn't matter here.
+    uint16_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t d;
+        uint32_t s = 0xFFFFFFFF;
+        memcpy(&d, dest + i, 4);
+        if (src) {
+            memcpy(&s, src + i, 4);
+        }
+        d = rasterWord(d, s, op);
+        memcpy(dest + i, &d, 4);
+    }
+    for (; i < size; i++) {
+        dest[i] = rasterWord(dest[i], src ? src[i] : 0xFF, op);
+    }
+}
+
+void FrameBuffer::writePBM(Print &out) const {
+    // Binary PBM (P4): same row layout as the frame, but 1 = black, so bits are inverted
+    out.print("P4\n");
+    out.print(WIDTH);
+    out.print(' ');
+    out.print(HEIGHT);
+    out.print('\n');
+    const uint8_t *buffer = getBuffer();
+    const uint16_t size = bufferSize();
+    for (uint16_t i = 0; i < size; i++) {
+        out.write((uint8_t)~buffer[i]);
+    }
+}
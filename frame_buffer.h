@@ -0,0 +1,38 @@
+#ifndef FRAME_BUFFER_H
+#define FRAME_BUFFER_H
+
+#include <Adafruit_GFX.h>
+
+// fillCrescent tracks this many columns either side of the centre
+#define CRESCENT_MAX_COLUMNS 256
+
+// Ways of combining a source into a destination of the same layout, a byte or word at a time
+enum RasterOp : uint8_t {
+    ROP_AND,    // dest & src
+    ROP_OR,     // dest | src
+    ROP_XOR,    // dest ^ src
+    ROP_ANDNOT  // dest & ~src
+};
+
+// Whole-buffer raster ops on RAM (not PROGMEM) buffers; src == NULL means all bits set,
+// so ROP_XOR with no source inverts
+void rasterOp(uint8_t *dest, const uint8_t *src, uint16_t size, RasterOp op);
+
+// 1-bit offscreen frame the watch face is drawn into before it is pushed to the panel.
+// Uses the same layout as GxEPD2 and Adafruit bitmaps: rows of MSB-first bytes, bit set = white.
+class FrameBuffer : public GFXcanvas1 {
+    public:
+        FrameBuffer(uint16_t w, uint16_t h) : GFXcanvas1(w, h) {}
+        uint16_t bytesPerRow() const { return (WIDTH + 7) / 8; }
+        uint16_t bufferSize() const { return bytesPerRow() * HEIGHT; }
+        void drawBitmapFast(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+        void fillCrescent(int16_t x0, int16_t y0, int16_t maskY0, int32_t r, uint16_t color);
+        void drawPackedBitmapWindow(int16_t x, int16_t y, const uint8_t packed[], int16_t w, int16_t h,
+                                    uint16_t color, int16_t wx, int16_t wy, int16_t ww, int16_t wh);
+        void writePBM(Print &out) const;
+    private:
+        void drawBitmapByte(int16_t x, int16_t y, uint8_t bits, uint16_t color,
+                            int16_t xMin, int16_t xMax);
+};
+
+#endif
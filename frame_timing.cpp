@@ -0,0 +1,108 @@
+#include "frame_timing.h"
+
+#ifdef ESP_PLATFORM
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+RTC_DATA_ATTR StageRing stageRings[STAGE_COUNT];
+RTC_DATA_ATTR PanelStats panelStats;
+uint32_t stageStarts[STAGE_COUNT];
+
+const char *stageNames[STAGE_COUNT] = {
+    "fill", "dayn", "sun", "mask", "time", "date", "step", "batt", "push", "all"
+};
+
+uint32_t timingNowMicros() {
+#ifdef ESP_PLATFORM
+    return (uint32_t)esp_timer_get_time();
+#else
+    static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - origin).count();
+#endif
+}
+
+void timingBegin(FrameStage stage) {
+    stageStarts[stage] = timingNowMicros();
+}
+
+void timingEnd(FrameStage stage) {
+    uint32_t elapsed = timingNowMicros() - stageStarts[stage];
+    StageRing &ring = stageRings[stage];
+    if (ring.count == 0 || elapsed < ring.min) {
+        ring.min = elapsed;
+    }
+    if (elapsed > ring.max) {
+        ring.max = elapsed;
+    }
+    ring.samples[ring.head] = elapsed;
+    ring.head = (ring.head + 1) % TIMING_RING_LENGTH;
+    if (ring.count < TIMING_RING_LENGTH) {
+        ring.count++;
+    }
+}
+
+void timingReset() {
+    memset(stageRings, 0, sizeof(stageRings));
+    memset(&panelStats, 0, sizeof(panelStats));
+}
+
+StageStats timingStats(FrameStage stage) {
+    // min/max are all-time since the last reset, mean is over the samples still in the ring
+    const StageRing &ring = stageRings[stage];
+    StageStats stats = {};
+    stats.count = ring.count;
+    if (ring.count == 0) {
+        return stats;
+    }
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < ring.count; i++) {
+        sum += ring.samples[i];
+    }
+    stats.last = ring.samples[(ring.head + TIMING_RING_LENGTH - 1) % TIMING_RING_LENGTH];
+    stats.min = ring.min;
+    stats.mean = sum / ring.count;
+    stats.max = ring.max;
+    return stats;
+}
+
+const char *timingStageName(FrameStage stage) {
+    return stageNames[stage];
+}
+
+void timingPanelPush(int16_t w, int16_t h) {
+    // Window is sent a byte (8 pixels) wide at a time. GxEPD2 writes each partial window
+    // twice (new and previous image), so SPI traffic is about double this either way.
+    uint32_t bytes = (uint32_t)((w + 7) / 8) * h;
+    panelStats.last = bytes;
+    panelStats.total += bytes;
+    panelStats.pushes++;
+}
+
+void writeFrameTiming(Print &out) {
+    // CSV, all times in microseconds
+    out.println("stage,last_us,min_us,mean_us,max_us,samples");
+    for (uint8_t i = 0; i < STAGE_COUNT; i++) {
+        StageStats stats = timingStats((FrameStage)i);
+        out.print(stageNames[i]);
+        out.print(',');
+        out.print(stats.last);
+        out.print(',');
+        out.print(stats.min);
+        out.print(',');
+        out.print(stats.mean);
+        out.print(',');
+        out.print(stats.max);
+        out.print(',');
+        out.println(stats.count);
+    }
+    out.println("panel,last_bytes,total_bytes,pushes");
+    out.print("panel,");
+    out.print(panelStats.last);
+    out.print(',');
+    out.print(panelStats.total);
+    out.print(',');
+    out.println(panelStats.pushes);
+}
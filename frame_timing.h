@@ -0,0 +1,59 @@
+#ifndef FRAME_TIMING_H
+#define FRAME_TIMING_H
+
+#include <Arduino.h>
+
+#ifndef RTC_DATA_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+// Samples kept per stage; the rings live in RTC memory so they survive deep sleep
+#define TIMING_RING_LENGTH 16
+
+enum FrameStage {
+    STAGE_FILL,
+    STAGE_DAY_NIGHT,
+    STAGE_SUN,
+    STAGE_MASKS,
+    STAGE_TIME,
+    STAGE_DATE,
+    STAGE_STEPS,
+    STAGE_BATTERY,
+    STAGE_PRESENT,
+    STAGE_FRAME,
+    STAGE_COUNT
+};
+
+struct StageRing {
+    uint32_t samples[TIMING_RING_LENGTH];
+    uint8_t head;
+    uint8_t count;
+    uint32_t min;
+    uint32_t max;
+};
+
+// Frame data sent to the panel controller, to compare full and partial updates
+struct PanelStats {
+    uint32_t last;  // bytes in the last push
+    uint32_t total; // bytes since the last reset
+    uint16_t pushes;
+};
+
+struct StageStats {
+    uint32_t last;
+    uint32_t min;
+    uint32_t mean;
+    uint32_t max;
+    uint8_t count;
+};
+
+uint32_t timingNowMicros();
+void timingBegin(FrameStage stage);
+void timingEnd(FrameStage stage);
+void timingReset();
+StageStats timingStats(FrameStage stage);
+const char *timingStageName(FrameStage stage);
+void timingPanelPush(int16_t w, int16_t h);
+void writeFrameTiming(Print &out);
+
+#endif
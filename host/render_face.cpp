@@ -0,0 +1,33 @@
+// Renders watch faces on the host and writes them as a stream of binary PBM frames
+// (the same output RENDER_SWEEP sends over serial), e.g.
+//     render_face 0 365 60 faces.pbm
+//     render_face 172 172 1 | convert - day172-%04d.png
+// Arguments: first day of year, last day, minute step, output file (default stdout)
+
+#include "WatchyChronometer.h"
+
+class FilePrint : public Print {
+    public:
+        explicit FilePrint(FILE *file) : file(file) {}
+        size_t write(uint8_t c) override { return fputc(c, file) == EOF ? 0 : 1; }
+        size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, file); }
+        using Print::write;
+    private:
+        FILE *file;
+};
+
+int main(int argc, char **argv) {
+    uint16_t firstDay = argc > 1 ? atoi(argv[1]) : 0;
+    uint16_t lastDay = argc > 2 ? atoi(argv[2]) : 365;
+    uint16_t minuteStep = argc > 3 ? atoi(argv[3]) : 60;
+    FILE *file = argc > 4 ? fopen(argv[4], "wb") : stdout;
+    if (!file || minuteStep == 0 || lastDay > 365) {
+        fprintf(stderr, "usage: %s [first_day [last_day [minute_step [out.pbm]]]]\n", argv[0]);
+        return 2;
+    }
+    watchySettings settings = {};
+    WatchyChron watchy(settings);
+    FilePrint out(file);
+    watchy.renderSweep(out, firstDay, lastDay, minuteStep);
+    return fclose(file) == 0 ? 0 : 1;
+}
@@ -0,0 +1,377 @@
+#include <Adafruit_GFX.h>
+
+// Ported from Adafruit GFX 1.11 (BSD licence), custom fonts only
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    writeLine(x, y, x, y + h - 1, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    writeLine(x, y, x + w - 1, y, color);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+    }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 == x1 && y0 != y1) {
+        if (y0 > y1) {
+            std::swap(y0, y1);
+        }
+        drawFastVLine(x0, y0, y1 - y0 + 1, color);
+        return;
+    }
+    if (y0 == y1 && x0 != x1) {
+        if (x0 > x1) {
+            std::swap(x0, x1);
+        }
+        drawFastHLine(x0, y0, x1 - x0 + 1, color);
+        return;
+    }
+    writeLine(x0, y0, x1, y1, color);
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    // Bresenham
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) {
+            drawPixel(y0, x0, color);
+        } else {
+            drawPixel(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+    fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta,
+                                    uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    int16_t px = x;
+    int16_t py = y;
+    delta++;
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (x < (y + 1)) {
+            if (corners & 1) {
+                drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+            }
+            if (corners & 2) {
+                drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+            }
+        }
+        if (y != py) {
+            if (corners & 1) {
+                drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+            }
+            if (corners & 2) {
+                drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+            }
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                              uint16_t color) {
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) {
+                b <<= 1;
+            } else {
+                b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            }
+            if (b & 0x80) {
+                drawPixel(x + i, y, color);
+            }
+        }
+    }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+                              uint16_t color, uint16_t bg) {
+    int16_t byteWidth = (w + 7) / 8;
+    uint8_t b = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+            if (i & 7) {
+                b <<= 1;
+            } else {
+                b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+            }
+            drawPixel(x + i, y, (b & 0x80) ? color : bg);
+        }
+    }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg,
+                            uint8_t size) {
+    (void)bg;
+    (void)size;
+    if (!gfxFont) {
+        return;
+    }
+    c -= (uint8_t)pgm_read_byte(&gfxFont->first);
+    GFXglyph *glyph = gfxFont->glyph + c;
+    uint8_t *bitmap = gfxFont->bitmap;
+    uint16_t bo = glyph->bitmapOffset;
+    uint8_t w = glyph->width;
+    uint8_t h = glyph->height;
+    int8_t xo = glyph->xOffset;
+    int8_t yo = glyph->yOffset;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (uint8_t yy = 0; yy < h; yy++) {
+        for (uint8_t xx = 0; xx < w; xx++) {
+            if (!(bit++ & 7)) {
+                bits = pgm_read_byte(&bitmap[bo++]);
+            }
+            if (bits & 0x80) {
+                drawPixel(x + xo + xx, y + yo + yy, color);
+            }
+            bits <<= 1;
+        }
+    }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    if (!gfxFont) {
+        cursor_x += 6;
+        return 1;
+    }
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    } else if (c != '\r') {
+        uint8_t first = pgm_read_byte(&gfxFont->first);
+        if (c >= first && c <= (uint8_t)pgm_read_byte(&gfxFont->last)) {
+            GFXglyph *glyph = gfxFont->glyph + (c - first);
+            uint8_t w = glyph->width;
+            uint8_t h = glyph->height;
+            if (w > 0 && h > 0) {
+                int16_t xo = glyph->xOffset;
+                if (wrap && (cursor_x + (xo + w)) > _width) {
+                    cursor_x = 0;
+                    cursor_y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+                }
+                drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, 1);
+            }
+            cursor_x += glyph->xAdvance;
+        }
+    }
+    return 1;
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny,
+                              int16_t *maxx, int16_t *maxy) {
+    if (!gfxFont) {
+        return;
+    }
+    if (c == '\n') {
+        *x = 0;
+        *y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    } else if (c != '\r') {
+        uint8_t first = pgm_read_byte(&gfxFont->first);
+        uint8_t last = pgm_read_byte(&gfxFont->last);
+        if (c >= first && c <= last) {
+            GFXglyph *glyph = gfxFont->glyph + (c - first);
+            uint8_t gw = glyph->width;
+            uint8_t gh = glyph->height;
+            uint8_t xa = glyph->xAdvance;
+            int8_t xo = glyph->xOffset;
+            int8_t yo = glyph->yOffset;
+            if (wrap && ((*x + ((int16_t)xo + gw)) > _width)) {
+                *x = 0;
+                *y += (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+            }
+            int16_t x1 = *x + xo;
+            int16_t y1 = *y + yo;
+            int16_t x2 = x1 + gw - 1;
+            int16_t y2 = y1 + gh - 1;
+            if (x1 < *minx) {
+                *minx = x1;
+            }
+            if (y1 < *miny) {
+                *miny = y1;
+            }
+            if (x2 > *maxx) {
+                *maxx = x2;
+            }
+            if (y2 > *maxy) {
+                *maxy = y2;
+            }
+            *x += xa;
+        }
+    }
+}
+
+void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1,
+                                 uint16_t *w, uint16_t *h) {
+    uint8_t c;
+    int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    *x1 = x;
+    *y1 = y;
+    *w = *h = 0;
+    while ((c = *str++)) {
+        charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+    }
+    if (maxx >= minx) {
+        *x1 = minx;
+        *w = maxx - minx + 1;
+    }
+    if (maxy >= miny) {
+        *y1 = miny;
+        *h = maxy - miny + 1;
+    }
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+    rotation = r & 3;
+    _width = rotation & 1 ? HEIGHT : WIDTH;
+    _height = rotation & 1 ? WIDTH : HEIGHT;
+}
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+    buffer = (uint8_t *)calloc(((w + 7) / 8) * h, 1);
+}
+
+GFXcanvas1::~GFXcanvas1() {
+    free(buffer);
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return;
+    }
+    int16_t t;
+    switch (rotation) {
+        case 1:
+            t = x;
+            x = WIDTH - 1 - y;
+            y = t;
+            break;
+        case 2:
+            x = WIDTH - 1 - x;
+            y = HEIGHT - 1 - y;
+            break;
+        case 3:
+            t = x;
+            x = y;
+            y = HEIGHT - 1 - t;
+            break;
+    }
+    uint8_t *ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+    if (color) {
+        *ptr |= 0x80 >> (x & 7);
+    } else {
+        *ptr &= ~(0x80 >> (x & 7));
+    }
+}
+
+bool GFXcanvas1::getPixel(int16_t x, int16_t y) const {
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT || rotation != 0) {
+        return false;
+    }
+    return buffer[(x / 8) + y * ((WIDTH + 7) / 8)] & (0x80 >> (x & 7));
+}
+
+void GFXcanvas1::fillScreen(uint16_t color) {
+    memset(buffer, color ? 0xFF : 0x00, ((WIDTH + 7) / 8) * HEIGHT);
+}
+
+void GFXcanvas1::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    if (h < 0) {
+        h *= -1;
+        y -= h - 1;
+        if (y < 0) {
+            h += y;
+            y = 0;
+        }
+    }
+    if (x < 0 || x >= width() || y >= height() || (y + h - 1) < 0) {
+        return;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (y + h > height()) {
+        h = height() - y;
+    }
+    for (int16_t i = 0; i < h; i++) {
+        drawPixel(x, y + i, color);
+    }
+}
+
+void GFXcanvas1::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (w < 0) {
+        w *= -1;
+        x -= w - 1;
+        if (x < 0) {
+            w += x;
+            x = 0;
+        }
+    }
+    if (y < 0 || y >= height() || x >= width() || (x + w - 1) < 0) {
+        return;
+    }
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (x + w >= width()) {
+        w = width() - x;
+    }
+    for (int16_t i = 0; i < w; i++) {
+        drawPixel(x + i, y, color);
+    }
+}
@@ -0,0 +1,91 @@
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+// The parts of Adafruit GFX the sketch uses, ported so they set the same pixels:
+// tests compare the fast paths against these.
+
+#include <Arduino.h>
+
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+    uint8_t *bitmap;
+    GFXglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} GFXfont;
+
+class Adafruit_GFX : public Print {
+    public:
+        Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+        virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+        virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+        virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+        virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+        virtual void fillScreen(uint16_t color);
+        virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+        void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+        void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+        void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta,
+                              uint16_t color);
+        void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color);
+        void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color,
+                        uint16_t bg);
+        void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+        void getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w,
+                           uint16_t *h);
+        void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+        int16_t getCursorX() const { return cursor_x; }
+        int16_t getCursorY() const { return cursor_y; }
+        void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+        void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+        void setTextWrap(bool w) { wrap = w; }
+        void setTextSize(uint8_t s) { (void)s; }
+        void setFont(const GFXfont *f) { gfxFont = (GFXfont *)f; }
+        void setRotation(uint8_t r);
+        uint8_t getRotation() const { return rotation; }
+        int16_t width() const { return _width; }
+        int16_t height() const { return _height; }
+        size_t write(uint8_t c) override;
+        using Print::write;
+    protected:
+        // Bresenham with no straight-line shortcuts, so the fast lines can fall back on it
+        void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+        void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny,
+                        int16_t *maxx, int16_t *maxy);
+        const int16_t WIDTH;
+        const int16_t HEIGHT;
+        int16_t _width;
+        int16_t _height;
+        int16_t cursor_x = 0;
+        int16_t cursor_y = 0;
+        uint16_t textcolor = 0xFFFF;
+        uint16_t textbgcolor = 0xFFFF;
+        bool wrap = true;
+        uint8_t rotation = 0;
+        GFXfont *gfxFont = nullptr;
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+    public:
+        GFXcanvas1(uint16_t w, uint16_t h);
+        ~GFXcanvas1();
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+        void fillScreen(uint16_t color) override;
+        void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+        void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+        bool getPixel(int16_t x, int16_t y) const;
+        uint8_t *getBuffer() const { return buffer; }
+    private:
+        uint8_t *buffer;
+};
+
+#endif
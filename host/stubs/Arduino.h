@@ -0,0 +1,113 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Just enough of the ESP32 Arduino core to build the sketch on Linux
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define memcpy_P memcpy
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+typedef uint8_t byte;
+
+// Time only moves when a test or a (light) sleep moves it, see host_hw.h
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode);
+void detachInterrupt(uint8_t pin);
+
+// The real String keeps any text on the heap, where std::string keeps short text in place:
+// hostStringAllocs counts the allocations the real one would make
+inline uint32_t hostStringAllocs = 0;
+
+class String {
+    public:
+        String(const char *s = "") : s(s ? s : "") { counted(); }
+        String(const std::string &s) : s(s) { counted(); }
+        String(const String &o) : s(o.s) { counted(); }
+        String(char c) : s(1, c) { counted(); }
+        String(int v) : s(std::to_string(v)) { counted(); }
+        String(unsigned v) : s(std::to_string(v)) { counted(); }
+        String(long v) : s(std::to_string(v)) { counted(); }
+        String(unsigned long v) : s(std::to_string(v)) { counted(); }
+        String &operator=(const String &o) { s = o.s; counted(); return *this; }
+        const char *c_str() const { return s.c_str(); }
+        unsigned length() const { return s.size(); }
+        bool concat(const String &o) { s += o.s; counted(); return true; }
+        String &operator+=(const String &o) { concat(o); return *this; }
+        String operator+(const String &o) const { return String(s + o.s); }
+        bool operator==(const String &o) const { return s == o.s; }
+    private:
+        void counted() { hostStringAllocs += !s.empty(); }
+        std::string s;
+};
+
+class Print {
+    public:
+        virtual ~Print() {}
+        virtual size_t write(uint8_t c) = 0;
+        virtual size_t write(const uint8_t *buffer, size_t size) {
+            for (size_t i = 0; i < size; i++) {
+                write(buffer[i]);
+            }
+            return size;
+        }
+        size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+        size_t print(const char *str) { return write(str); }
+        size_t print(const String &str) { return write(str.c_str()); }
+        size_t print(char c) { return write((uint8_t)c); }
+        size_t print(int n) { return printf("%d", n); }
+        size_t print(unsigned n) { return printf("%u", n); }
+        size_t print(long n) { return printf("%ld", n); }
+        size_t print(unsigned long n) { return printf("%lu", n); }
+        size_t print(double n, int digits = 2) { return printf("%.*f", digits, n); }
+        size_t println() { return write((const uint8_t *)"\r\n", 2); }
+        template <typename T> size_t println(T value) { return print(value) + println(); }
+        size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+    public:
+        void begin(unsigned long baud) { (void)baud; }
+        void flush() { fflush(stdout); }
+        size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+        using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif
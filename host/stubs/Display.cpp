@@ -0,0 +1,92 @@
+#include <Display.h>
+
+WatchyDisplay::WatchyDisplay() {
+    memset(ram, 0xFF, sizeof(ram));
+    memset(panel, 0xFF, sizeof(panel));
+    resetCounters();
+}
+
+void WatchyDisplay::resetCounters() {
+    bytesWritten = 0;
+    fullRefreshes = 0;
+    partialRefreshes = 0;
+}
+
+void WatchyDisplay::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                               bool invert, bool mirror_y, bool pgm) {
+    writeImagePart(bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
+}
+
+void WatchyDisplay::writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                                    bool invert, bool mirror_y, bool pgm) {
+    writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+}
+
+void WatchyDisplay::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                                   int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h,
+                                   bool invert, bool mirror_y, bool pgm) {
+    // Same rounding and clipping as GxEPD2_154_D67::writeImagePart
+    (void)mirror_y;
+    (void)pgm;
+    if (x_part < 0 || x_part >= w_bitmap || y_part < 0 || y_part >= h_bitmap) {
+        return;
+    }
+    int16_t wb = (w_bitmap + 7) / 8;
+    x_part -= x_part % 8;
+    w = w_bitmap - x_part < w ? w_bitmap - x_part : w;
+    h = h_bitmap - y_part < h ? h_bitmap - y_part : h;
+    x -= x % 8;
+    w = 8 * ((w + 7) / 8);
+    int16_t x1 = x < 0 ? 0 : x;
+    int16_t y1 = y < 0 ? 0 : y;
+    int16_t w1 = x + w < int16_t(WIDTH) ? w : int16_t(WIDTH) - x;
+    int16_t h1 = y + h < int16_t(HEIGHT) ? h : int16_t(HEIGHT) - y;
+    int16_t dx = x1 - x;
+    int16_t dy = y1 - y;
+    w1 -= dx;
+    h1 -= dy;
+    if (w1 <= 0 || h1 <= 0) {
+        return;
+    }
+    for (int16_t i = 0; i < h1; i++) {
+        for (int16_t j = 0; j < w1 / 8; j++) {
+            uint8_t data = bitmap[(j + dx / 8 + x_part / 8) + (i + dy + y_part) * wb];
+            ram[(x1 / 8 + j) + (y1 + i) * (WIDTH / 8)] = invert ? ~data : data;
+            bytesWritten++;
+        }
+    }
+}
+
+void WatchyDisplay::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                                        int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h,
+                                        bool invert, bool mirror_y, bool pgm) {
+    writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+}
+
+void WatchyDisplay::refresh(bool partial_update_mode) {
+    if (busyCallback) {
+        busyCallback(busyParam);
+    }
+    memcpy(panel, ram, sizeof(panel));
+    if (partial_update_mode) {
+        partialRefreshes++;
+    } else {
+        fullRefreshes++;
+    }
+}
+
+void WatchyDisplay::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (busyCallback) {
+        busyCallback(busyParam);
+    }
+    x = max(x, (int16_t)0);
+    y = max(y, (int16_t)0);
+    w = min(w, (int16_t)(WIDTH - x));
+    h = min(h, (int16_t)(HEIGHT - y));
+    for (int16_t row = y; row < y + h; row++) {
+        for (int16_t col = x / 8; col < (x + w + 7) / 8; col++) {
+            panel[row * (WIDTH / 8) + col] = ram[row * (WIDTH / 8) + col];
+        }
+    }
+    partialRefreshes++;
+}
@@ -0,0 +1,54 @@
+#ifndef HOST_DISPLAY_H
+#define HOST_DISPLAY_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <GxEPD2.h>
+
+// Stand-in for Watchy's GDEH0154D67 driver (GxEPD2 epd2 interface). Frame data lands in
+// a copy of the controller RAM and shows on the "panel" at the next refresh; every byte sent
+// over SPI is counted.
+class WatchyDisplay {
+    public:
+        static const uint16_t WIDTH = 200;
+        static const uint16_t HEIGHT = 200;
+        static const uint16_t WIDTH_VISIBLE = WIDTH;
+        static const bool hasFastPartialUpdate = true;
+        static const uint16_t BUFFER_SIZE = WIDTH / 8 * HEIGHT;
+
+        WatchyDisplay();
+        void selectSPI(SPIClass &spi, SPISettings settings) { (void)spi; (void)settings; }
+        void setBusyCallback(void (*callback)(const void *), const void *p = 0) {
+            busyCallback = callback;
+            busyParam = p;
+        }
+        void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                        bool invert = false, bool mirror_y = false, bool pgm = false);
+        void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                             bool invert = false, bool mirror_y = false, bool pgm = false);
+        void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                            int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h,
+                            bool invert = false, bool mirror_y = false, bool pgm = false);
+        void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                                 int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h,
+                                 bool invert = false, bool mirror_y = false, bool pgm = false);
+        void refresh(bool partial_update_mode = false);
+        void refresh(int16_t x, int16_t y, int16_t w, int16_t h);
+        void powerOff() {}
+        void hibernate() {}
+
+        // Host only
+        uint8_t ram[BUFFER_SIZE];
+        uint8_t panel[BUFFER_SIZE];
+        uint32_t bytesWritten;
+        uint16_t fullRefreshes;
+        uint16_t partialRefreshes;
+        void resetCounters();
+    private:
+        // GxEPD2 calls this while it waits out a refresh; the host panel is never busy for
+        // long, so it runs once per refresh
+        void (*busyCallback)(const void *) = nullptr;
+        const void *busyParam = nullptr;
+};
+
+#endif
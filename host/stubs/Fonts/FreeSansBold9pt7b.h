@@ -0,0 +1,9 @@
+#ifndef HOST_FREESANSBOLD9PT7B_H
+#define HOST_FREESANSBOLD9PT7B_H
+
+// See FreeMonoBold9pt7b.h
+#include <Adafruit_GFX.h>
+#include "../../../Seven_Segment10pt7b.h"
+#define FreeSansBold9pt7b Seven_Segment10pt7b
+
+#endif
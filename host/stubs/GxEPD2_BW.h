@@ -0,0 +1,71 @@
+#ifndef HOST_GXEPD2_BW_H
+#define HOST_GXEPD2_BW_H
+
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+
+// Full-frame buffered display, like GxEPD2_BW with page_height == HEIGHT
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+    public:
+        GxEPD2_Type epd2;
+
+        GxEPD2_BW(GxEPD2_Type epd2_instance)
+            : Adafruit_GFX(GxEPD2_Type::WIDTH_VISIBLE, GxEPD2_Type::HEIGHT), epd2(epd2_instance) {
+            memset(_buffer, 0xFF, sizeof(_buffer));
+        }
+
+        void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10,
+                  bool pulldown_rst_mode = false) {
+            (void)serial_diag_bitrate;
+            (void)initial;
+            (void)reset_duration;
+            (void)pulldown_rst_mode;
+        }
+
+        void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+            if (x < 0 || x >= width() || y < 0 || y >= height()) {
+                return;
+            }
+            uint16_t i = x / 8 + y * (WIDTH / 8);
+            if (color) {
+                _buffer[i] |= 1 << (7 - x % 8);
+            } else {
+                _buffer[i] &= ~(1 << (7 - x % 8));
+            }
+        }
+
+        void fillScreen(uint16_t color) override {
+            memset(_buffer, color == GxEPD_BLACK ? 0x00 : 0xFF, sizeof(_buffer));
+        }
+
+        void setFullWindow() {}
+
+        void display(bool partial_update_mode = false) {
+            epd2.writeImage(_buffer, 0, 0, WIDTH, page_height);
+            epd2.refresh(partial_update_mode);
+            epd2.writeImageAgain(_buffer, 0, 0, WIDTH, page_height);
+        }
+
+        void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+            x = min(x, width());
+            y = min(y, height());
+            w = min(w, (int16_t)(width() - x));
+            h = min(h, (int16_t)(height() - y));
+            w += x % 8;
+            if (w % 8 > 0) {
+                w += 8 - w % 8;
+            }
+            x -= x % 8;
+            epd2.writeImagePart(_buffer, x, y, WIDTH, page_height, x, y, w, h);
+            epd2.refresh(x, y, w, h);
+            epd2.writeImagePartAgain(_buffer, x, y, WIDTH, page_height, x, y, w, h);
+        }
+
+        void hibernate() { epd2.hibernate(); }
+
+    private:
+        uint8_t _buffer[(GxEPD2_Type::WIDTH / 8) * page_height];
+};
+
+#endif
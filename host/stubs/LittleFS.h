@@ -0,0 +1,53 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+// Stand-in for the ESP32 LittleFS mount. The files stay in the working directory, but, like
+// the /littlefs VFS paths on the watch, they can't be opened, renamed or removed until begin()
+// has mounted them. Only the sketch's storage code includes this, so its stdio calls on those
+// files come through here; tests set hostFsMounted = false to simulate a wake from deep sleep.
+
+#include <stdio.h>
+#include <errno.h>
+#include <host_hw.h>
+
+class LittleFSFS {
+    public:
+        bool begin(bool formatOnFail = false) {
+            (void)formatOnFail;
+            hostFsMounted = true;
+            return true;
+        }
+        void end() { hostFsMounted = false; }
+};
+
+inline LittleFSFS LittleFS;
+
+inline FILE *hostFsOpen(const char *path, const char *mode) {
+    if (!hostFsMounted) {
+        errno = ENOENT;
+        return nullptr;
+    }
+    return fopen(path, mode);
+}
+
+inline int hostFsRename(const char *from, const char *to) {
+    if (!hostFsMounted) {
+        errno = ENOENT;
+        return -1;
+    }
+    return rename(from, to);
+}
+
+inline int hostFsRemove(const char *path) {
+    if (!hostFsMounted) {
+        errno = ENOENT;
+        return -1;
+    }
+    return remove(path);
+}
+
+#define fopen hostFsOpen
+#define rename hostFsRename
+#define remove hostFsRemove
+
+#endif
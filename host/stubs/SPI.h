@@ -0,0 +1,21 @@
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+struct SPISettings {
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {
+        (void)clock;
+        (void)bitOrder;
+        (void)dataMode;
+    }
+};
+
+class SPIClass {};
+
+extern SPIClass SPI;
+
+#endif
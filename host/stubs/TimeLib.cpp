@@ -0,0 +1,77 @@
+#include <TimeLib.h>
+
+// Private to Time.cpp in the real library
+#define LEAP_YEAR(Y) (((1970 + (Y)) > 0) && !((1970 + (Y)) % 4) && (((1970 + (Y)) % 100) || !((1970 + (Y)) % 400)))
+
+static const uint8_t monthDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+static const char *const dayNames[] = {"Err", "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday",
+                                       "Friday", "Saturday"};
+static const char monthShortNames[] = "ErrJanFebMarAprMayJunJulAugSepOctNovDec";
+static char buffer[10];
+
+void breakTime(time_t timeInput, tmElements_t &tm) {
+    uint32_t time = (uint32_t)timeInput;
+    tm.Second = time % 60;
+    time /= 60;
+    tm.Minute = time % 60;
+    time /= 60;
+    tm.Hour = time % 24;
+    time /= 24;
+    tm.Wday = ((time + 4) % 7) + 1; // 1 Jan 1970 was a Thursday
+    uint8_t year = 0;
+    unsigned long days = 0;
+    while ((unsigned)(days += (LEAP_YEAR(year) ? 366 : 365)) <= time) {
+        year++;
+    }
+    tm.Year = year;
+    days -= LEAP_YEAR(year) ? 366 : 365;
+    time -= days;
+    uint8_t month;
+    uint8_t monthLength = 0;
+    for (month = 0; month < 12; month++) {
+        if (month == 1) {
+            monthLength = LEAP_YEAR(year) ? 29 : 28;
+        } else {
+            monthLength = monthDays[month];
+        }
+        if (time >= monthLength) {
+            time -= monthLength;
+        } else {
+            break;
+        }
+    }
+    tm.Month = month + 1;
+    tm.Day = time + 1;
+}
+
+time_t makeTime(const tmElements_t &tm) {
+    uint32_t seconds = tm.Year * (SECS_PER_DAY * 365);
+    for (int i = 0; i < tm.Year; i++) {
+        if (LEAP_YEAR(i)) {
+            seconds += SECS_PER_DAY;
+        }
+    }
+    for (int i = 1; i < tm.Month; i++) {
+        if (i == 2 && LEAP_YEAR(tm.Year)) {
+            seconds += SECS_PER_DAY * 29;
+        } else {
+            seconds += SECS_PER_DAY * monthDays[i - 1];
+        }
+    }
+    seconds += (tm.Day - 1) * SECS_PER_DAY;
+    seconds += tm.Hour * SECS_PER_HOUR;
+    seconds += tm.Minute * SECS_PER_MIN;
+    seconds += tm.Second;
+    return (time_t)seconds;
+}
+
+char *dayStr(uint8_t day) {
+    strcpy(buffer, dayNames[day < 8 ? day : 0]);
+    return buffer;
+}
+
+char *monthShortStr(uint8_t month) {
+    memcpy(buffer, &monthShortNames[(month < 13 ? month : 0) * 3], 3);
+    buffer[3] = 0;
+    return buffer;
+}
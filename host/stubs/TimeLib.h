@@ -0,0 +1,32 @@
+#ifndef HOST_TIMELIB_H
+#define HOST_TIMELIB_H
+
+#include <Arduino.h>
+#include <time.h>
+
+// Same fields and arithmetic as PaulStoffregen's TimeLib
+
+typedef struct {
+    uint8_t Second;
+    uint8_t Minute;
+    uint8_t Hour;
+    uint8_t Wday; // Sunday is 1
+    uint8_t Day;
+    uint8_t Month;
+    uint8_t Year; // offset from 1970
+} tmElements_t;
+
+#define tmYearToCalendar(Y) ((Y) + 1970)
+#define CalendarYrToTm(Y) ((Y) - 1970)
+
+#define SECS_PER_MIN ((time_t)(60UL))
+#define SECS_PER_HOUR ((time_t)(3600UL))
+#define SECS_PER_DAY ((time_t)(SECS_PER_HOUR * 24UL))
+
+void breakTime(time_t time, tmElements_t &tm);
+time_t makeTime(const tmElements_t &tm);
+// Both return the same static buffer, like TimeLib
+char *dayStr(uint8_t day);
+char *monthShortStr(uint8_t month);
+
+#endif
@@ -0,0 +1,173 @@
+#include <Watchy.h>
+#include <host_hw.h>
+#include <driver/gpio.h>
+
+WatchyRTC Watchy::RTC;
+GxEPD2_BW<WatchyDisplay, WatchyDisplay::HEIGHT> Watchy::display(WatchyDisplay{});
+
+RTC_DATA_ATTR int guiState;
+RTC_DATA_ATTR int menuIndex;
+RTC_DATA_ATTR BMA423 sensor;
+RTC_DATA_ATTR bool WIFI_CONFIGURED;
+RTC_DATA_ATTR bool alreadyInMenu = true;
+RTC_DATA_ATTR bool displayFullInit = true;
+
+void WatchyRTC::read(tmElements_t &tm) {
+    breakTime(hostRtcTime, tm);
+}
+
+void WatchyRTC::set(tmElements_t tm) {
+    hostRtcTime = makeTime(tm);
+}
+
+uint32_t BMA423::getCounter() {
+    return hostStepCount;
+}
+
+bool BMA423::resetStepCounter() {
+    hostStepCount = 0;
+    return true;
+}
+
+void Watchy::init(String datetime) {
+    // Same dispatch as the library
+    (void)datetime;
+    display.epd2.setBusyCallback(displayBusyCallback);
+    switch (esp_sleep_get_wakeup_cause()) {
+        case ESP_SLEEP_WAKEUP_EXT0: // RTC alarm
+            RTC.read(currentTime);
+            switch (guiState) {
+                case WATCHFACE_STATE:
+                    showWatchFace(true);
+                    if (settings.vibrateOClock && currentTime.Minute == 0) {
+                        vibMotor(75, 4);
+                    }
+                    break;
+                case MAIN_MENU_STATE:
+                    if (alreadyInMenu) {
+                        guiState = WATCHFACE_STATE;
+                        showWatchFace(false);
+                    } else {
+                        alreadyInMenu = true;
+                    }
+                    break;
+            }
+            break;
+        case ESP_SLEEP_WAKEUP_EXT1: // button
+            handleButtonPress();
+            break;
+        default: // reset
+            RTC.read(currentTime);
+            showWatchFace(false);
+            vibMotor(200, 4);
+            break;
+    }
+    deepSleep();
+}
+
+void Watchy::deepSleep() {
+    display.hibernate();
+    displayFullInit = false;
+    hostDeepSleeps++;
+}
+
+void Watchy::displayBusyCallback(const void *) {
+    // As in the library: sleep until BUSY goes low, and leave that wakeup armed
+    gpio_wakeup_enable((gpio_num_t)DISPLAY_BUSY, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_light_sleep_start();
+}
+
+float Watchy::getBatteryVoltage() {
+    return hostBatteryVoltage;
+}
+
+void Watchy::vibMotor(uint8_t intervalMs, uint8_t length) {
+    (void)intervalMs;
+    (void)length;
+}
+
+void Watchy::handleButtonPress() {}
+
+void Watchy::showMenu(byte menuIndex, bool partialRefresh) {
+    display.setFullWindow();
+    display.fillScreen(GxEPD_BLACK);
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_WHITE);
+    display.setCursor(0, MENU_HEIGHT);
+    display.print("Menu ");
+    display.print((int)menuIndex);
+    display.display(partialRefresh);
+    guiState = MAIN_MENU_STATE;
+    alreadyInMenu = false;
+}
+
+void Watchy::showFastMenu(byte menuIndex) {
+    showMenu(menuIndex, true);
+}
+
+void Watchy::showApp(const char *title) {
+    guiState = APP_STATE;
+    display.setFullWindow();
+    display.fillScreen(GxEPD_BLACK);
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_WHITE);
+    display.setCursor(0, 20);
+    display.print(title);
+    display.display(false);
+}
+
+void Watchy::showAbout() {
+    showApp("About");
+}
+
+void Watchy::showBuzz() {
+    showApp("Buzz");
+}
+
+void Watchy::showAccelerometer() {
+    // The library polls the buttons until BACK, then goes back to its own menu
+    showApp("Accelerometer");
+    showMenu(menuIndex, false);
+}
+
+void Watchy::showUpdateFW() {
+    showApp("Update FW");
+    guiState = FW_UPDATE_STATE;
+}
+
+void Watchy::showSyncNTP() {
+    showApp("Sync NTP");
+}
+
+bool Watchy::syncNTP() {
+    return false;
+}
+
+void Watchy::setTime() {
+    // Like showAccelerometer, ends on the library's menu
+    showApp("Set Time");
+    showMenu(menuIndex, false);
+}
+
+void Watchy::setupWifi() {
+    showApp("Setup WiFi");
+}
+
+bool Watchy::connectWiFi() {
+    return WIFI_CONFIGURED;
+}
+
+void Watchy::updateFWBegin() {
+    showApp("Updating");
+}
+
+void Watchy::showWatchFace(bool partialRefresh) {
+    hostLibraryFaces++;
+    display.setFullWindow();
+    drawWatchFace();
+    display.display(partialRefresh);
+    guiState = WATCHFACE_STATE;
+}
+
+void Watchy::drawWatchFace() {}
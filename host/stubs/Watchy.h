@@ -0,0 +1,108 @@
+#ifndef HOST_WATCHY_H
+#define HOST_WATCHY_H
+
+// Host stand-in for the Watchy 1.4 library: same class layout and globals, with the
+// hardware replaced by the fakes in host_hw.h and the library screens reduced to stubs
+// that draw a placeholder and set guiState like the real ones.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+#include <TimeLib.h>
+#include <esp_sleep.h>
+#include <GxEPD2_BW.h>
+#include <Display.h>
+#include <WiFi.h>
+#include <Fonts/FreeMonoBold9pt7b.h>
+
+#define MENU_BTN_PIN 26
+#define BACK_BTN_PIN 25
+#define UP_BTN_PIN 32
+#define DOWN_BTN_PIN 4
+#define MENU_BTN_MASK (1ULL << MENU_BTN_PIN)
+#define BACK_BTN_MASK (1ULL << BACK_BTN_PIN)
+#define UP_BTN_MASK (1ULL << UP_BTN_PIN)
+#define DOWN_BTN_MASK (1ULL << DOWN_BTN_PIN)
+#define DISPLAY_BUSY 19
+
+#define DISPLAY_WIDTH 200
+#define DISPLAY_HEIGHT 200
+
+#define WATCHFACE_STATE -1
+#define MAIN_MENU_STATE 0
+#define APP_STATE 1
+#define FW_UPDATE_STATE 2
+#define MENU_HEIGHT 25
+#define MENU_LENGTH 7
+
+typedef struct watchySettings {
+    String cityID;
+    String weatherAPIKey;
+    String weatherURL;
+    String weatherUnit;
+    String weatherLang;
+    int8_t weatherUpdateInterval;
+    String ntpServer;
+    int gmtOffset;
+    bool vibrateOClock;
+} watchySettings;
+
+class WatchyRTC {
+    public:
+        void init() {}
+        void config(String datetime) { (void)datetime; }
+        void clearAlarm() {}
+        void read(tmElements_t &tm);
+        void set(tmElements_t tm);
+};
+
+class BMA423 {
+    public:
+        uint32_t getCounter();
+        bool resetStepCounter();
+};
+
+class Watchy {
+    public:
+        static WatchyRTC RTC;
+        static GxEPD2_BW<WatchyDisplay, WatchyDisplay::HEIGHT> display;
+        tmElements_t currentTime;
+        watchySettings settings;
+
+    public:
+        explicit Watchy(const watchySettings &s) : settings(s) {}
+        virtual ~Watchy() {}
+        void init(String datetime = "");
+        void deepSleep();
+        static void displayBusyCallback(const void *);
+        float getBatteryVoltage();
+        void vibMotor(uint8_t intervalMs = 100, uint8_t length = 20);
+
+        virtual void handleButtonPress();
+        void showMenu(byte menuIndex, bool partialRefresh);
+        void showFastMenu(byte menuIndex);
+        void showAbout();
+        void showBuzz();
+        void showAccelerometer();
+        void showUpdateFW();
+        void showSyncNTP();
+        bool syncNTP();
+        void setTime();
+        void setupWifi();
+        bool connectWiFi();
+        void updateFWBegin();
+
+        void showWatchFace(bool partialRefresh);
+        virtual void drawWatchFace();
+
+    private:
+        void showApp(const char *title);
+};
+
+extern RTC_DATA_ATTR int guiState;
+extern RTC_DATA_ATTR int menuIndex;
+extern RTC_DATA_ATTR BMA423 sensor;
+extern RTC_DATA_ATTR bool WIFI_CONFIGURED;
+extern RTC_DATA_ATTR bool alreadyInMenu;
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST };
+
+// The stand-in client: tests queue requests in hostHttpRequests, each handleClient() call
+// serves one, and the answered requests move to hostHttpServed with the response filled in
+struct HostHttpExchange {
+    HTTPMethod method;
+    std::string uri;
+    std::string body;
+    int code;
+    std::string response;
+};
+
+inline std::deque<HostHttpExchange> hostHttpRequests;
+inline std::vector<HostHttpExchange> hostHttpServed;
+
+class WebServer {
+    public:
+        explicit WebServer(int port) { (void)port; }
+        void on(const char *uri, HTTPMethod method, std::function<void()> handler) {
+            routes.push_back({uri, method, handler});
+        }
+        void begin() { running = true; }
+        void stop() { running = false; }
+        void handleClient() {
+            if (!running || hostHttpRequests.empty()) {
+                return;
+            }
+            current = hostHttpRequests.front();
+            hostHttpRequests.pop_front();
+            current.code = 404;
+            for (const Route &route : routes) {
+                if (route.uri == current.uri && (route.method == HTTP_ANY || route.method == current.method)) {
+                    route.handler();
+                    break;
+                }
+            }
+            hostHttpServed.push_back(current);
+        }
+        void setContentLength(size_t length) { (void)length; }
+        void send(int code, const char *type, const String &content) {
+            (void)type;
+            current.code = code;
+            current.response = content.c_str();
+        }
+        void sendContent(const String &content) { current.response += content.c_str(); }
+        String arg(const char *name) { return strcmp(name, "plain") == 0 ? String(current.body) : String(); }
+    private:
+        struct Route {
+            std::string uri;
+            HTTPMethod method;
+            std::function<void()> handler;
+        };
+        std::vector<Route> routes;
+        HostHttpExchange current;
+        bool running = false;
+};
+
+#endif
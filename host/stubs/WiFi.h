@@ -0,0 +1,23 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+#define WIFI_OFF 0
+#define WIFI_STA 1
+
+class IPAddress {
+    public:
+        String toString() const { return String("127.0.0.1"); }
+};
+
+class WiFiClass {
+    public:
+        bool mode(int m) { (void)m; return true; }
+        bool disconnect(bool wifiOff = false) { (void)wifiOff; return true; }
+        IPAddress localIP() const { return IPAddress(); }
+};
+
+extern WiFiClass WiFi;
+
+#endif
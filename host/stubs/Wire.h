@@ -0,0 +1,20 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+#define SDA 21
+#define SCL 22
+
+class TwoWire {
+    public:
+        bool begin(int sda, int scl) {
+            (void)sda;
+            (void)scl;
+            return true;
+        }
+};
+
+extern TwoWire Wire;
+
+#endif
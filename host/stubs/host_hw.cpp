@@ -0,0 +1,181 @@
+#include <host_hw.h>
+#include <driver/gpio.h>
+#include <SPI.h>
+#include <Wire.h>
+#include <WiFi.h>
+#include <stdarg.h>
+
+#define HOST_PIN_COUNT 40
+
+HardwareSerial Serial;
+SPIClass SPI;
+TwoWire Wire;
+WiFiClass WiFi;
+
+esp_sleep_wakeup_cause_t hostWakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+uint64_t hostExt1Status = 0;
+time_t hostRtcTime = 0;
+float hostBatteryVoltage = 4.0;
+uint32_t hostStepCount = 0;
+uint16_t hostDeepSleeps = 0;
+uint16_t hostLibraryFaces = 0;
+bool hostTimelineDone = false;
+uint32_t hostLightSleepSpins = 0;
+bool hostFsMounted = false;
+
+static uint32_t nowMs = 0;
+static uint8_t pinLevels[HOST_PIN_COUNT];
+static void (*pinHandlers[HOST_PIN_COUNT])(void *);
+static void *pinArgs[HOST_PIN_COUNT];
+static gpio_int_type_t pinWakeups[HOST_PIN_COUNT];
+static bool timerWakeup = false;
+static uint64_t timerWakeupUs = 0;
+static const HostPinEvent *timeline = nullptr;
+static size_t timelineLength = 0;
+static size_t timelineNext = 0;
+
+size_t Print::printf(const char *format, ...) {
+    char line[128];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    return write((const uint8_t *)line, min((size_t)n, sizeof(line) - 1));
+}
+
+uint32_t millis() {
+    return nowMs;
+}
+
+uint32_t micros() {
+    return nowMs * 1000;
+}
+
+void hostSetMillis(uint32_t ms) {
+    nowMs = ms;
+}
+
+void hostSetPin(uint8_t pin, uint8_t level) {
+    if (pinLevels[pin] == level) {
+        return;
+    }
+    pinLevels[pin] = level;
+    if (pinHandlers[pin]) {
+        pinHandlers[pin](pinArgs[pin]);
+    }
+}
+
+void hostPlayTimeline(const HostPinEvent *events, size_t count) {
+    timeline = events;
+    timelineLength = count;
+    timelineNext = 0;
+    hostTimelineDone = false;
+}
+
+// Applies timeline events up to and including until; stops early (and returns true) after an
+// event that light sleep is waiting for
+static bool wakesOn(uint8_t pin, uint8_t level) {
+    return pinWakeups[pin] == (level == HIGH ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+}
+
+static bool runTimeline(uint32_t until, bool sleeping) {
+    while (timelineNext < timelineLength && timeline[timelineNext].ms <= until) {
+        const HostPinEvent &event = timeline[timelineNext++];
+        nowMs = max(nowMs, event.ms);
+        hostSetPin(event.pin, event.level);
+        if (sleeping && wakesOn(event.pin, event.level)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void hostAdvance(uint32_t ms) {
+    uint32_t until = nowMs + ms;
+    runTimeline(until, false);
+    nowMs = until;
+}
+
+void delay(uint32_t ms) {
+    hostAdvance(ms);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    (void)pin;
+    (void)mode;
+}
+
+int digitalRead(uint8_t pin) {
+    return pinLevels[pin];
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    pinLevels[pin] = value;
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void *), void *arg, int mode) {
+    (void)mode;
+    pinHandlers[pin] = handler;
+    pinArgs[pin] = arg;
+}
+
+void detachInterrupt(uint8_t pin) {
+    pinHandlers[pin] = nullptr;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+    return hostWakeupCause;
+}
+
+uint64_t esp_sleep_get_ext1_wakeup_status() {
+    return hostExt1Status;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source) {
+    if (source == ESP_SLEEP_WAKEUP_TIMER || source == ESP_SLEEP_WAKEUP_ALL) {
+        timerWakeup = false;
+    }
+    return 0;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+    return 0;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t timeUs) {
+    timerWakeup = true;
+    timerWakeupUs = timeUs;
+    return 0;
+}
+
+esp_err_t esp_light_sleep_start() {
+    for (uint8_t pin = 0; pin < HOST_PIN_COUNT; pin++) {
+        if (wakesOn(pin, pinLevels[pin])) {
+            // A level wakeup that is already true; the wake still takes a moment, so a loop
+            // that keeps doing this sees time pass instead of hanging the test
+            hostLightSleepSpins++;
+            hostAdvance(1);
+            return 0;
+        }
+    }
+    uint64_t wake = timerWakeup ? nowMs + timerWakeupUs / 1000 : UINT32_MAX;
+    if (runTimeline((uint32_t)min(wake, (uint64_t)UINT32_MAX), true)) {
+        return 0;
+    }
+    if (!timerWakeup) {
+        hostTimelineDone = true;
+        return 0;
+    }
+    nowMs = (uint32_t)wake;
+    return 0;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio, gpio_int_type_t type) {
+    pinWakeups[gpio] = type;
+    return 0;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio) {
+    pinWakeups[gpio] = GPIO_INTR_DISABLE;
+    return 0;
+}
@@ -0,0 +1,39 @@
+#ifndef HOST_HW_H
+#define HOST_HW_H
+
+// Fake hardware behind the host stubs. Tests set these up and read them back.
+
+#include <Arduino.h>
+#include <TimeLib.h>
+#include <esp_sleep.h>
+
+// A recorded button timeline: pin goes to level at ms
+struct HostPinEvent {
+    uint32_t ms;
+    uint8_t pin;
+    uint8_t level;
+};
+
+extern esp_sleep_wakeup_cause_t hostWakeupCause;
+extern uint64_t hostExt1Status;
+extern time_t hostRtcTime;
+extern float hostBatteryVoltage;
+extern uint32_t hostStepCount;
+// Counted by Watchy::deepSleep and by the library's own watch face (Watchy::showWatchFace)
+extern uint16_t hostDeepSleeps;
+extern uint16_t hostLibraryFaces;
+// Set when light sleep had nothing left to wake it: no timer and no more timeline events
+extern bool hostTimelineDone;
+// Light sleeps that returned at once because a wakeup level was already true
+extern uint32_t hostLightSleepSpins;
+// Whether LittleFS is mounted; see LittleFS.h
+extern bool hostFsMounted;
+
+void hostSetMillis(uint32_t ms);
+// Replays events as the fake clock passes them: edge interrupts fire if attached, and light
+// sleep wakes on a level it was told to wait for. The array must outlive the replay.
+void hostPlayTimeline(const HostPinEvent *events, size_t count);
+void hostAdvance(uint32_t ms);
+void hostSetPin(uint8_t pin, uint8_t level);
+
+#endif
@@ -0,0 +1,375 @@
+#ifndef HOST_TESTS_BASELINE_LOOKUPS_H
+#define HOST_TESTS_BASELINE_LOOKUPS_H
+
+// dayNightLookup as it was before the compact encoding in lookups.h: {centre, radius, sunrise, sunset}
+
+const int baselineDayNightLookup[366][4] = {
+/*   0 */   {286,186,298,1142},
+/*   1 */   {287,187,299,1141},
+/*   2 */   {288,188,299,1141},
+/*   3 */   {288,188,299,1141},
+/*   4 */   {289,189,299,1141},
+/*   5 */   {290,190,300,1140},
+/*   6 */   {291,191,300,1140},
+/*   7 */   {292,192,300,1140},
+/*   8 */   {294,194,301,1139},
+/*   9 */   {295,195,301,1139},
+/*  10 */   {296,196,302,1138},
+/*  11 */   {298,198,302,1138},
+/*  12 */   {299,199,302,1138},
+/*  13 */   {301,201,303,1137},
+/*  14 */   {302,202,303,1137},
+/*  15 */   {304,204,304,1136},
+/*  16 */   {306,206,304,1136},
+/*  17 */   {308,208,305,1135},
+/*  18 */   {310,210,305,1135},
+/*  19 */   {312,212,306,1134},
+/*  20 */   {314,214,307,1133},
+/*  21 */   {317,217,307,1133},
+/*  22 */   {319,219,308,1132},
+/*  23 */   {322,222,308,1132},
+/*  24 */   {324,224,309,1131},
+/*  25 */   {327,227,310,1130},
+/*  26 */   {330,230,310,1130},
+/*  27 */   {333,233,311,1129},
+/*  28 */   {337,237,312,1128},
+/*  29 */   {340,240,312,1128},
+/*  30 */   {344,244,313,1127},
+/*  31 */   {348,248,314,1126},
+/*  32 */   {352,252,315,1125},
+/*  33 */   {356,256,315,1125},
+/*  34 */   {360,260,316,1124},
+/*  35 */   {365,265,317,1123},
+/*  36 */   {370,270,318,1122},
+/*  37 */   {375,275,318,1122},
+/*  38 */   {380,280,319,1121},
+/*  39 */   {386,286,320,1120},
+/*  40 */   {392,292,321,1119},
+/*  41 */   {398,298,322,1118},
+/*  42 */   {405,305,323,1117},
+/*  43 */   {412,312,324,1116},
+/*  44 */   {420,320,324,1116},
+/*  45 */   {428,328,325,1115},
+/*  46 */   {436,336,326,1114},
+/*  47 */   {445,345,327,1113},
+/*  48 */   {455,355,328,1112},
+/*  49 */   {465,365,329,1111},
+/*  50 */   {476,376,330,1110},
+/*  51 */   {487,387,331,1109},
+/*  52 */   {500,400,332,1108},
+/*  53 */   {513,413,332,1108},
+/*  54 */   {528,428,333,1107},
+/*  55 */   {544,444,334,1106},
+/*  56 */   {560,460,335,1105},
+/*  57 */   {579,479,336,1104},
+/*  58 */   {599,499,337,1103},
+/*  59 */   {621,521,338,1102},
+/*  60 */   {645,545,339,1101},
+/*  61 */   {671,571,340,1100},
+/*  62 */   {700,600,341,1099},
+/*  63 */   {733,633,342,1098},
+/*  64 */   {769,669,343,1097},
+/*  65 */   {810,710,344,1096},
+/*  66 */   {857,757,345,1095},
+/*  67 */   {910,810,346,1094},
+/*  68 */   {972,872,347,1093},
+/*  69 */   {1044,944,348,1092},
+/*  70 */   {1128,1028,349,1091},
+/*  71 */   {1231,1131,350,1090},
+/*  72 */   {1355,1255,351,1089},
+/*  73 */   {1512,1412,352,1088},
+/*  74 */   {1712,1612,353,1087},
+/*  75 */   {1980,1880,354,1086},
+/*  76 */   {2356,2256,355,1085},
+/*  77 */   {2919,2819,356,1084},
+/*  78 */   {3857,3757,357,1083},
+/*  79 */   {5735,5635,358,1082},
+/*  80 */   {11369,11269,359,1081},
+/*  81 */   {99,1,360,1080},
+/*  82 */   {-11169,11269,361,1079},
+/*  83 */   {-5535,5635,362,1078},
+/*  84 */   {-3657,3757,363,1077},
+/*  85 */   {-2719,2819,364,1076},
+/*  86 */   {-2156,2256,365,1075},
+/*  87 */   {-1780,1880,366,1074},
+/*  88 */   {-1512,1612,367,1073},
+/*  89 */   {-1312,1412,368,1072},
+/*  90 */   {-1155,1255,369,1071},
+/*  91 */   {-1031,1131,370,1070},
+/*  92 */   {-928,1028,371,1069},
+/*  93 */   {-844,944,372,1068},
+/*  94 */   {-772,872,373,1067},
+/*  95 */   {-710,810,374,1066},
+/*  96 */   {-657,757,375,1065},
+/*  97 */   {-610,710,376,1064},
+/*  98 */   {-569,669,377,1063},
+/*  99 */   {-533,633,378,1062},
+/* 100 */   {-500,600,379,1061},
+/* 101 */   {-471,571,380,1060},
+/* 102 */   {-445,545,381,1059},
+/* 103 */   {-421,521,382,1058},
+/* 104 */   {-399,499,383,1057},
+/* 105 */   {-379,479,384,1056},
+/* 106 */   {-360,460,385,1055},
+/* 107 */   {-344,444,386,1054},
+/* 108 */   {-328,428,387,1053},
+/* 109 */   {-313,413,388,1052},
+/* 110 */   {-300,400,388,1052},
+/* 111 */   {-287,387,389,1051},
+/* 112 */   {-276,376,390,1050},
+/* 113 */   {-265,365,391,1049},
+/* 114 */   {-255,355,392,1048},
+/* 115 */   {-245,345,393,1047},
+/* 116 */   {-236,336,394,1046},
+/* 117 */   {-228,328,395,1045},
+/* 118 */   {-220,320,396,1044},
+/* 119 */   {-212,312,396,1044},
+/* 120 */   {-205,305,397,1043},
+/* 121 */   {-198,298,398,1042},
+/* 122 */   {-192,292,399,1041},
+/* 123 */   {-186,286,400,1040},
+/* 124 */   {-180,280,401,1039},
+/* 125 */   {-175,275,402,1038},
+/* 126 */   {-170,270,402,1038},
+/* 127 */   {-165,265,403,1037},
+/* 128 */   {-160,260,404,1036},
+/* 129 */   {-156,256,405,1035},
+/* 130 */   {-152,252,405,1035},
+/* 131 */   {-148,248,406,1034},
+/* 132 */   {-144,244,407,1033},
+/* 133 */   {-140,240,408,1032},
+/* 134 */   {-137,237,408,1032},
+/* 135 */   {-133,233,409,1031},
+/* 136 */   {-130,230,410,1030},
+/* 137 */   {-127,227,410,1030},
+/* 138 */   {-124,224,411,1029},
+/* 139 */   {-122,222,412,1028},
+/* 140 */   {-119,219,412,1028},
+/* 141 */   {-117,217,413,1027},
+/* 142 */   {-114,214,413,1027},
+/* 143 */   {-112,212,414,1026},
+/* 144 */   {-110,210,415,1025},
+/* 145 */   {-108,208,415,1025},
+/* 146 */   {-106,206,416,1024},
+/* 147 */   {-104,204,416,1024},
+/* 148 */   {-102,202,417,1023},
+/* 149 */   {-101,201,417,1023},
+/* 150 */   {-99,199,418,1022},
+/* 151 */   {-98,198,418,1022},
+/* 152 */   {-96,196,418,1022},
+/* 153 */   {-95,195,419,1021},
+/* 154 */   {-94,194,419,1021},
+/* 155 */   {-92,192,420,1020},
+/* 156 */   {-91,191,420,1020},
+/* 157 */   {-90,190,420,1020},
+/* 158 */   {-89,189,421,1019},
+/* 159 */   {-88,188,421,1019},
+/* 160 */   {-88,188,421,1019},
+/* 161 */   {-87,187,421,1019},
+/* 162 */   {-86,186,422,1018},
+/* 163 */   {-86,186,422,1018},
+/* 164 */   {-85,185,422,1018},
+/* 165 */   {-85,185,422,1018},
+/* 166 */   {-84,184,422,1018},
+/* 167 */   {-84,184,422,1018},
+/* 168 */   {-84,184,423,1017},
+/* 169 */   {-83,183,423,1017},
+/* 170 */   {-83,183,423,1017},
+/* 171 */   {-83,183,423,1017},
+/* 172 */   {-83,183,423,1017},
+/* 173 */   {-83,183,423,1017},
+/* 174 */   {-83,183,423,1017},
+/* 175 */   {-83,183,423,1017},
+/* 176 */   {-83,183,423,1017},
+/* 177 */   {-84,184,423,1017},
+/* 178 */   {-84,184,422,1018},
+/* 179 */   {-84,184,422,1018},
+/* 180 */   {-85,185,422,1018},
+/* 181 */   {-85,185,422,1018},
+/* 182 */   {-86,186,422,1018},
+/* 183 */   {-87,187,422,1018},
+/* 184 */   {-87,187,421,1019},
+/* 185 */   {-88,188,421,1019},
+/* 186 */   {-89,189,421,1019},
+/* 187 */   {-90,190,420,1020},
+/* 188 */   {-91,191,420,1020},
+/* 189 */   {-92,192,420,1020},
+/* 190 */   {-93,193,419,1021},
+/* 191 */   {-94,194,419,1021},
+/* 192 */   {-95,195,419,1021},
+/* 193 */   {-97,197,418,1022},
+/* 194 */   {-98,198,418,1022},
+/* 195 */   {-100,200,417,1023},
+/* 196 */   {-101,201,417,1023},
+/* 197 */   {-103,203,416,1024},
+/* 198 */   {-105,205,416,1024},
+/* 199 */   {-107,207,415,1025},
+/* 200 */   {-109,209,415,1025},
+/* 201 */   {-111,211,414,1026},
+/* 202 */   {-113,213,414,1026},
+/* 203 */   {-115,215,413,1027},
+/* 204 */   {-118,218,413,1027},
+/* 205 */   {-120,220,412,1028},
+/* 206 */   {-123,223,411,1029},
+/* 207 */   {-126,226,411,1029},
+/* 208 */   {-129,229,410,1030},
+/* 209 */   {-132,232,409,1031},
+/* 210 */   {-135,235,409,1031},
+/* 211 */   {-138,238,408,1032},
+/* 212 */   {-142,242,407,1033},
+/* 213 */   {-146,246,407,1033},
+/* 214 */   {-150,250,406,1034},
+/* 215 */   {-154,254,405,1035},
+/* 216 */   {-158,258,404,1036},
+/* 217 */   {-162,262,403,1037},
+/* 218 */   {-167,267,403,1037},
+/* 219 */   {-172,272,402,1038},
+/* 220 */   {-178,278,401,1039},
+/* 221 */   {-183,283,400,1040},
+/* 222 */   {-189,289,399,1041},
+/* 223 */   {-195,295,399,1041},
+/* 224 */   {-202,302,398,1042},
+/* 225 */   {-209,309,397,1043},
+/* 226 */   {-216,316,396,1044},
+/* 227 */   {-224,324,395,1045},
+/* 228 */   {-232,332,394,1046},
+/* 229 */   {-241,341,393,1047},
+/* 230 */   {-250,350,393,1047},
+/* 231 */   {-260,360,392,1048},
+/* 232 */   {-270,370,391,1049},
+/* 233 */   {-282,382,390,1050},
+/* 234 */   {-294,394,389,1051},
+/* 235 */   {-307,407,388,1052},
+/* 236 */   {-321,421,387,1053},
+/* 237 */   {-336,436,386,1054},
+/* 238 */   {-352,452,385,1055},
+/* 239 */   {-369,469,384,1056},
+/* 240 */   {-389,489,383,1057},
+/* 241 */   {-409,509,382,1058},
+/* 242 */   {-432,532,381,1059},
+/* 243 */   {-458,558,380,1060},
+/* 244 */   {-485,585,379,1061},
+/* 245 */   {-516,616,378,1062},
+/* 246 */   {-551,651,377,1063},
+/* 247 */   {-589,689,376,1064},
+/* 248 */   {-633,733,375,1065},
+/* 249 */   {-683,783,375,1065},
+/* 250 */   {-740,840,374,1066},
+/* 251 */   {-806,906,373,1067},
+/* 252 */   {-884,984,372,1068},
+/* 253 */   {-977,1077,371,1069},
+/* 254 */   {-1090,1190,370,1070},
+/* 255 */   {-1229,1329,369,1071},
+/* 256 */   {-1405,1505,368,1072},
+/* 257 */   {-1636,1736,367,1073},
+/* 258 */   {-1951,2051,366,1074},
+/* 259 */   {-2406,2506,365,1075},
+/* 260 */   {-3121,3221,364,1076},
+/* 261 */   {-4408,4508,363,1077},
+/* 262 */   {-7413,7513,362,1078},
+/* 263 */   {-22437,22537,361,1079},
+/* 264 */   {22637,22537,359,1081},
+/* 265 */   {7613,7513,358,1082},
+/* 266 */   {4608,4508,357,1083},
+/* 267 */   {3321,3221,356,1084},
+/* 268 */   {2606,2506,355,1085},
+/* 269 */   {2151,2051,354,1086},
+/* 270 */   {1836,1736,353,1087},
+/* 271 */   {1605,1505,352,1088},
+/* 272 */   {1429,1329,351,1089},
+/* 273 */   {1290,1190,350,1090},
+/* 274 */   {1177,1077,349,1091},
+/* 275 */   {1084,984,348,1092},
+/* 276 */   {1006,906,347,1093},
+/* 277 */   {940,840,346,1094},
+/* 278 */   {883,783,345,1095},
+/* 279 */   {833,733,345,1095},
+/* 280 */   {789,689,344,1096},
+/* 281 */   {751,651,343,1097},
+/* 282 */   {716,616,342,1098},
+/* 283 */   {685,585,341,1099},
+/* 284 */   {658,558,340,1100},
+/* 285 */   {632,532,339,1101},
+/* 286 */   {609,509,338,1102},
+/* 287 */   {589,489,337,1103},
+/* 288 */   {569,469,336,1104},
+/* 289 */   {552,452,335,1105},
+/* 290 */   {536,436,334,1106},
+/* 291 */   {521,421,333,1107},
+/* 292 */   {507,407,332,1108},
+/* 293 */   {494,394,331,1109},
+/* 294 */   {482,382,330,1110},
+/* 295 */   {470,370,329,1111},
+/* 296 */   {460,360,328,1112},
+/* 297 */   {450,350,327,1113},
+/* 298 */   {441,341,327,1113},
+/* 299 */   {432,332,326,1114},
+/* 300 */   {424,324,325,1115},
+/* 301 */   {416,316,324,1116},
+/* 302 */   {409,309,323,1117},
+/* 303 */   {402,302,322,1118},
+/* 304 */   {395,295,321,1119},
+/* 305 */   {389,289,321,1119},
+/* 306 */   {383,283,320,1120},
+/* 307 */   {378,278,319,1121},
+/* 308 */   {372,272,318,1122},
+/* 309 */   {367,267,317,1123},
+/* 310 */   {362,262,317,1123},
+/* 311 */   {358,258,316,1124},
+/* 312 */   {354,254,315,1125},
+/* 313 */   {350,250,314,1126},
+/* 314 */   {346,246,313,1127},
+/* 315 */   {342,242,313,1127},
+/* 316 */   {338,238,312,1128},
+/* 317 */   {335,235,311,1129},
+/* 318 */   {332,232,311,1129},
+/* 319 */   {329,229,310,1130},
+/* 320 */   {326,226,309,1131},
+/* 321 */   {323,223,309,1131},
+/* 322 */   {320,220,308,1132},
+/* 323 */   {318,218,307,1133},
+/* 324 */   {315,215,307,1133},
+/* 325 */   {313,213,306,1134},
+/* 326 */   {311,211,306,1134},
+/* 327 */   {309,209,305,1135},
+/* 328 */   {307,207,305,1135},
+/* 329 */   {305,205,304,1136},
+/* 330 */   {303,203,304,1136},
+/* 331 */   {301,201,303,1137},
+/* 332 */   {300,200,303,1137},
+/* 333 */   {298,198,302,1138},
+/* 334 */   {297,197,302,1138},
+/* 335 */   {295,195,301,1139},
+/* 336 */   {294,194,301,1139},
+/* 337 */   {293,193,301,1139},
+/* 338 */   {292,192,300,1140},
+/* 339 */   {291,191,300,1140},
+/* 340 */   {290,190,300,1140},
+/* 341 */   {289,189,299,1141},
+/* 342 */   {288,188,299,1141},
+/* 343 */   {287,187,299,1141},
+/* 344 */   {287,187,298,1142},
+/* 345 */   {286,186,298,1142},
+/* 346 */   {285,185,298,1142},
+/* 347 */   {285,185,298,1142},
+/* 348 */   {284,184,298,1142},
+/* 349 */   {284,184,298,1142},
+/* 350 */   {284,184,297,1143},
+/* 351 */   {283,183,297,1143},
+/* 352 */   {283,183,297,1143},
+/* 353 */   {283,183,297,1143},
+/* 354 */   {283,183,297,1143},
+/* 355 */   {283,183,297,1143},
+/* 356 */   {283,183,297,1143},
+/* 357 */   {283,183,297,1143},
+/* 358 */   {283,183,297,1143},
+/* 359 */   {284,184,297,1143},
+/* 360 */   {284,184,298,1142},
+/* 361 */   {284,184,298,1142},
+/* 362 */   {285,185,298,1142},
+/* 363 */   {285,185,298,1142},
+/* 364 */   {286,186,298,1142},
+/* 365 */   {286,186,298,1142}
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef HOST_TESTS_CHECK_H
+#define HOST_TESTS_CHECK_H
+
+// Minimal test helpers: CHECK keeps going and counts failures, main returns checkResult()
+
+#include <stdio.h>
+#include <chrono>
+
+static int checkFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            checkFailures++; \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+#define CHECK_EQ(a, b) \
+    do { \
+        long long checkA = (long long)(a), checkB = (long long)(b); \
+        if (checkA != checkB) { \
+            checkFailures++; \
+            fprintf(stderr, "%s:%d: CHECK_EQ failed: %s == %s (%lld vs %lld)\n", __FILE__, __LINE__, #a, #b, \
+                    checkA, checkB); \
+        } \
+    } while (0)
+
+static inline int checkResult() {
+    if (checkFailures) {
+        fprintf(stderr, "%d check(s) failed\n", checkFailures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
+
+// Microseconds per call of fn, averaged over count calls
+template <typename Fn> double benchMicros(int count, Fn fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+        fn(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / count;
+}
+
+#endif
@@ -0,0 +1,72 @@
+// drawBitmapFast must set the same pixels as Adafruit's drawBitmap for bitmaps of any width,
+// anywhere from fully off the left edge (x = -70) to fully off the right (x = 205), clipped at
+// the top and bottom, in both colours and on a busy background.
+
+#include "frame_buffer.h"
+#include "check.h"
+#include <vector>
+
+#define SIZE 200
+
+FrameBuffer fast(SIZE, SIZE);
+FrameBuffer reference(SIZE, SIZE);
+std::vector<uint8_t> background;
+
+void resetFrames() {
+    memcpy(fast.getBuffer(), background.data(), background.size());
+    memcpy(reference.getBuffer(), background.data(), background.size());
+}
+
+int main() {
+    srand(4);
+    for (uint16_t i = 0; i < fast.bufferSize(); i++) {
+        background.push_back(rand());
+    }
+    const int16_t widths[] = {1, 5, 8, 9, 15, 16, 17, 31, 45, 64, 70};
+    const int16_t ys[] = {-80, -20, -1, 0, 7, 120, 160, 199, 200};
+    const uint8_t rotations[] = {0, 1};
+    int blits = 0;
+    int wrong = 0;
+    for (uint8_t rotation : rotations) {
+        fast.setRotation(rotation);
+        reference.setRotation(rotation);
+        for (int16_t w : widths) {
+            const int16_t h = 3 + w % 50;
+            std::vector<uint8_t> bitmap((w + 7) / 8 * h);
+            for (uint8_t &b : bitmap) {
+                b = rand();
+            }
+            for (int16_t x = -70; x <= 205; x++) {
+                for (int16_t y : ys) {
+                    for (uint16_t color : {0, 1}) {
+                        resetFrames();
+                        fast.drawBitmapFast(x, y, bitmap.data(), w, h, color);
+                        reference.drawBitmap(x, y, bitmap.data(), w, h, color);
+                        wrong += memcmp(fast.getBuffer(), reference.getBuffer(), fast.bufferSize()) != 0;
+                        blits++;
+                    }
+                }
+            }
+        }
+    }
+    printf("%d blits compared\n", blits);
+    CHECK_EQ(wrong, 0);
+
+    // Per blit for a sun-sized icon at odd and byte-aligned x
+    fast.setRotation(0);
+    reference.setRotation(0);
+    std::vector<uint8_t> icon(6 * 45);
+    for (uint8_t &b : icon) {
+        b = rand();
+    }
+    for (int16_t x : {40, 43}) {
+        double gfx = benchMicros(20000, [&](int i) {
+            reference.drawBitmap(x, 60 + i % 8, icon.data(), 45, 45, i & 1);
+        });
+        double blit = benchMicros(20000, [&](int i) {
+            fast.drawBitmapFast(x, 60 + i % 8, icon.data(), 45, 45, i & 1);
+        });
+        printf("45x45 at x=%d: drawBitmap %.2f us, drawBitmapFast %.2f us\n", x, gfx, blit);
+    }
+    return checkResult();
+}
@@ -0,0 +1,104 @@
+// Recorded button timelines, with contact bounce, replayed through the debouncer and the
+// auto-repeat on their own and then through handleButtonPress on the main menu.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <host_hw.h>
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+WatchyDisplay &epd = Watchy::display.epd2;
+
+// Raw levels of one button: pressed at 0 with bounce, released at 120 with bounce
+const HostPinEvent bouncyTap[] = {
+    {0, DOWN_BTN_PIN, HIGH}, {3, DOWN_BTN_PIN, LOW}, {6, DOWN_BTN_PIN, HIGH}, {11, DOWN_BTN_PIN, LOW},
+    {14, DOWN_BTN_PIN, HIGH}, {120, DOWN_BTN_PIN, LOW}, {124, DOWN_BTN_PIN, HIGH}, {129, DOWN_BTN_PIN, LOW},
+};
+
+void checkDebounce() {
+    Debouncer d = {false, 0};
+    uint8_t presses = 0;
+    for (const HostPinEvent &event : bouncyTap) {
+        presses += debounceChange(d, event.level == HIGH, event.ms + 1000, INPUT_DEBOUNCE_MS);
+    }
+    CHECK_EQ(presses, 1);
+    CHECK(!d.stable);
+}
+
+void checkRepeatTimes() {
+    // Held for 1500 ms and polled every millisecond
+    const RepeatConfig config = {400, 200, 5};
+    const uint16_t expectedMs[] = {400, 600, 800, 1000, 1200, 1400};
+    AutoRepeat r;
+    repeatStart(r, 0, config);
+    uint8_t n = 0;
+    for (uint32_t ms = 0; ms < 1500; ms++) {
+        uint8_t repeat = repeatPoll(r, ms, config);
+        if (repeat == REPEAT_NONE) {
+            continue;
+        }
+        CHECK(n < 6);
+        if (n < 6) {
+            CHECK_EQ(ms, expectedMs[n]);
+            CHECK_EQ(repeat, n < 5 ? REPEAT_STEP : REPEAT_PAGE);
+        }
+        n++;
+    }
+    CHECK_EQ(n, 6);
+    // A late poll still catches up on the schedule
+    repeatStart(r, 0, config);
+    CHECK_EQ(repeatPoll(r, 450, config), REPEAT_STEP);
+    CHECK_EQ(repeatWaitMs(r, 450), 150);
+}
+
+// Wakes from deep sleep on the timeline's first press and runs the menu until it times out.
+// init installs the library's display busy callback, which arms a wakeup on BUSY low; the
+// waits between presses must still sleep, so the only light sleeps that return at once are
+// the callback's own, one per refresh.
+uint8_t replayMenu(const HostPinEvent *events, size_t count) {
+    guiState = MAIN_MENU_STATE;
+    menuIndex = 0;
+    hostSetMillis(0);
+    hostSetPin(events[0].pin, events[0].level);
+    hostWakeupCause = ESP_SLEEP_WAKEUP_EXT1;
+    hostExt1Status = 1ULL << events[0].pin;
+    hostPlayTimeline(events + 1, count - 1);
+    epd.resetCounters();
+    uint32_t spins = hostLightSleepSpins;
+    watchy.init();
+    CHECK_EQ(guiState, MAIN_MENU_STATE);
+    CHECK_EQ(hostLightSleepSpins - spins, (uint32_t)(epd.fullRefreshes + epd.partialRefreshes));
+    return menuIndex;
+}
+
+int main() {
+    checkDebounce();
+    checkRepeatTimes();
+
+    // One bouncy tap is one step
+    CHECK_EQ(replayMenu(bouncyTap, sizeof(bouncyTap) / sizeof(bouncyTap[0])), 1);
+
+    // A second tap soon after the first, while the CPU sleeps between them
+    const HostPinEvent twoTaps[] = {
+        {0, DOWN_BTN_PIN, HIGH}, {120, DOWN_BTN_PIN, LOW}, {124, DOWN_BTN_PIN, HIGH}, {129, DOWN_BTN_PIN, LOW},
+        {300, DOWN_BTN_PIN, HIGH}, {303, DOWN_BTN_PIN, LOW}, {306, DOWN_BTN_PIN, HIGH}, {420, DOWN_BTN_PIN, LOW},
+    };
+    CHECK_EQ(replayMenu(twoTaps, sizeof(twoTaps) / sizeof(twoTaps[0])), 2);
+
+    // Holding the button that woke the watch: the press, five repeats (400..1200 ms), then
+    // a page at 1400 ms that stops at the last item
+    const HostPinEvent heldFromWake[] = {{0, DOWN_BTN_PIN, HIGH}, {1500, DOWN_BTN_PIN, LOW}};
+    CHECK_EQ(replayMenu(heldFromWake, 2), CHRON_MENU_LENGTH - 1);
+
+    // Held on a second press: repeats at 700, 900 and 1100 ms, none after the release
+    const HostPinEvent heldLater[] = {
+        {0, DOWN_BTN_PIN, HIGH}, {100, DOWN_BTN_PIN, LOW}, {300, DOWN_BTN_PIN, HIGH}, {302, DOWN_BTN_PIN, LOW},
+        {305, DOWN_BTN_PIN, HIGH}, {1250, DOWN_BTN_PIN, LOW}, {1253, DOWN_BTN_PIN, HIGH}, {1256, DOWN_BTN_PIN, LOW},
+    };
+    CHECK_EQ(replayMenu(heldLater, sizeof(heldLater) / sizeof(heldLater[0])), 5);
+
+    // Up wraps around from the first item
+    const HostPinEvent upTap[] = {{0, UP_BTN_PIN, HIGH}, {80, UP_BTN_PIN, LOW}};
+    CHECK_EQ(replayMenu(upTap, 2), CHRON_MENU_LENGTH - 1);
+    return checkResult();
+}
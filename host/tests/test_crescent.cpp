@@ -0,0 +1,119 @@
+// drawDayNight draws the arc with fillCrescent. For every day of the table, in both colours, it
+// must set the same pixels as the two fillCircle calls it replaced, done in 32 bits. Adafruit's
+// own int16 fillCircle agrees too, except on the days where its 2 * r + 1 overflows.
+
+#include "WatchyChronometer.h"
+#include "lookups.h"
+#include "check.h"
+#include <vector>
+
+// As in WatchyChronometer.cpp
+#define DAY_NIGHT_THICKNESS 3
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+FrameBuffer &frame = WatchyChron::frame;
+
+extern uint16_t foregroundColor;
+extern uint16_t backgroundColor;
+extern DayNight dayNight;
+
+GFXcanvas1 reference(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+
+void vLine32(int32_t x, int32_t y, int32_t h, uint16_t color) {
+    if (x < 0 || x >= DISPLAY_WIDTH) {
+        return;
+    }
+    const int32_t top = max(y, (int32_t)0);
+    const int32_t bottom = min(y + h - 1, (int32_t)DISPLAY_HEIGHT - 1);
+    if (top <= bottom) {
+        reference.drawFastVLine(x, top, bottom - top + 1, color);
+    }
+}
+
+// Adafruit's fillCircle with every variable widened to 32 bits
+void fillCircle32(int32_t x0, int32_t y0, int32_t r, uint16_t color) {
+    vLine32(x0, y0 - r, 2 * r + 1, color);
+    int32_t f = 1 - r;
+    int32_t ddFx = 1;
+    int32_t ddFy = -2 * r;
+    int32_t x = 0;
+    int32_t y = r;
+    int32_t px = x;
+    int32_t py = y;
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddFy += 2;
+            f += ddFy;
+        }
+        x++;
+        ddFx += 2;
+        f += ddFx;
+        if (x < y + 1) {
+            vLine32(x0 + x, y0 - y, 2 * y + 1, color);
+            vLine32(x0 - x, y0 - y, 2 * y + 1, color);
+        }
+        if (y != py) {
+            vLine32(x0 + py, y0 - px, 2 * px + 1, color);
+            vLine32(x0 - py, y0 - px, 2 * px + 1, color);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+int16_t maskCentre() {
+    return dayNight.centre > 0 ? dayNight.centre + DAY_NIGHT_THICKNESS : dayNight.centre - DAY_NIGHT_THICKNESS;
+}
+
+void drawCrescent() {
+    frame.fillScreen(backgroundColor);
+    watchy.drawDayNight();
+}
+
+int main() {
+    const uint16_t colours[2][2] = {{GxEPD_BLACK, GxEPD_WHITE}, {GxEPD_WHITE, GxEPD_BLACK}};
+    int wrong = 0;
+    std::vector<uint16_t> adafruitDiffers;
+    for (const uint16_t *colour : colours) {
+        foregroundColor = colour[0];
+        backgroundColor = colour[1];
+        for (uint16_t day = 0; day < DAY_NIGHT_DAYS; day++) {
+            dayNight = lookupDayNight(day);
+            drawCrescent();
+
+            reference.fillScreen(backgroundColor);
+            fillCircle32(DISPLAY_WIDTH / 2, dayNight.centre, dayNight.radius, foregroundColor);
+            fillCircle32(DISPLAY_WIDTH / 2, maskCentre(), dayNight.radius, backgroundColor);
+            wrong += memcmp(frame.getBuffer(), reference.getBuffer(), frame.bufferSize()) != 0;
+
+            reference.fillScreen(backgroundColor);
+            reference.fillCircle(DISPLAY_WIDTH / 2, dayNight.centre, dayNight.radius, foregroundColor);
+            reference.fillCircle(DISPLAY_WIDTH / 2, maskCentre(), dayNight.radius, backgroundColor);
+            if (memcmp(frame.getBuffer(), reference.getBuffer(), frame.bufferSize()) != 0) {
+                adafruitDiffers.push_back(day);
+                // Those days really are past int16 range for the old code
+                CHECK(2 * dayNight.radius + 1 > INT16_MAX);
+            }
+        }
+    }
+    CHECK_EQ(wrong, 0);
+    // Days 263 and 264 (radius 22537), once per colour
+    const std::vector<uint16_t> overflowDays = {263, 264, 263, 264};
+    CHECK(adafruitDiffers == overflowDays);
+
+    // Per day, clearing the frame included in both
+    double circles = benchMicros(DAY_NIGHT_DAYS * 4, [](int i) {
+        dayNight = lookupDayNight(i % DAY_NIGHT_DAYS);
+        reference.fillScreen(backgroundColor);
+        reference.fillCircle(DISPLAY_WIDTH / 2, dayNight.centre, dayNight.radius, foregroundColor);
+        reference.fillCircle(DISPLAY_WIDTH / 2, maskCentre(), dayNight.radius, backgroundColor);
+    });
+    double crescent = benchMicros(DAY_NIGHT_DAYS * 4, [](int i) {
+        dayNight = lookupDayNight(i % DAY_NIGHT_DAYS);
+        drawCrescent();
+    });
+    printf("day/night: %.2f us as two circles, %.2f us as a crescent\n", circles, crescent);
+    return checkResult();
+}
@@ -0,0 +1,41 @@
+// The compact day/night tables in lookups.h decode to the baseline dayNightLookup for every
+// row, and monthStartDay gives leap-calendar rows.
+
+#include <Arduino.h>
+#include "lookups.h"
+#include "solar.h"
+#include "baseline_lookups.h"
+#include "check.h"
+
+int main() {
+    for (uint16_t day = 0; day < DAY_NIGHT_DAYS; day++) {
+        DayNight dayNight = lookupDayNight(day);
+        CHECK_EQ(dayNight.centre, baselineDayNightLookup[day][0]);
+        CHECK_EQ(dayNight.radius, baselineDayNightLookup[day][1]);
+        CHECK_EQ(dayNight.sunrise, baselineDayNightLookup[day][2]);
+        CHECK_EQ(dayNight.sunset, baselineDayNightLookup[day][3]);
+    }
+
+    // Row of the 1st of each month in a leap year; other years just never use row 59 (Feb 29)
+    const uint8_t monthDays[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    uint16_t row = 0;
+    for (uint8_t month = 1; month <= 12; month++) {
+        CHECK_EQ(monthStartDay[month], row);
+        row += monthDays[month - 1];
+    }
+    CHECK_EQ(row, DAY_NIGHT_DAYS);
+
+    volatile int32_t sink = 0;
+    double tableMicros = benchMicros(DAY_NIGHT_DAYS, [&](int day) {
+        const int *row = baselineDayNightLookup[day];
+        sink += row[0] + row[1] + row[2] + row[3];
+    });
+    double decodeMicros = benchMicros(DAY_NIGHT_DAYS, [&](int day) {
+        DayNight dayNight = lookupDayNight(day);
+        sink += dayNight.centre + dayNight.radius + dayNight.sunrise + dayNight.sunset;
+    });
+    printf("int table %.4f us, decode %.4f us per day (host); %u -> %u bytes\n", tableMicros, decodeMicros,
+           (unsigned)sizeof(baselineDayNightLookup),
+           (unsigned)(sizeof(dayNightCentreLookup) + sizeof(dayNightSunriseLookup)));
+    return checkResult();
+}
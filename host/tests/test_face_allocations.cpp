@@ -0,0 +1,91 @@
+// Rendering and pushing a face must not touch the heap: the watch never reboots between deep
+// sleeps, so every frame's allocations would fragment the same heap. malloc and friends are
+// replaced here to count calls while a frame is drawn; Strings are counted by the stand-in.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <host_hw.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+}
+
+bool counting = false;
+uint32_t heapCalls = 0;
+
+extern "C" void *malloc(size_t size) {
+    heapCalls += counting;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+    heapCalls += counting;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+    heapCalls += counting;
+    return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void *ptr) {
+    heapCalls += counting && ptr;
+    __libc_free(ptr);
+}
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+
+void setClock(uint8_t month, uint8_t day, uint8_t hour, uint8_t minute) {
+    tmElements_t tm = {};
+    tm.Year = CalendarYrToTm(2024);
+    tm.Month = month;
+    tm.Day = day;
+    tm.Hour = hour;
+    tm.Minute = minute;
+    hostRtcTime = makeTime(tm);
+    Watchy::RTC.read(watchy.currentTime);
+}
+
+int main() {
+    // Every combination of the face's toggles, over days and minutes that change every text
+    int frames = 0;
+    uint32_t heap = 0;
+    uint32_t strings = 0;
+    for (uint8_t toggles = 0; toggles < 8; toggles++) {
+        showTime = toggles & 1;
+        showStats = toggles & 2;
+        darkMode = toggles & 4;
+        for (uint8_t month = 1; month <= 12; month += 5) {
+            for (uint16_t minute = 0; minute < 24 * 60; minute += 97) {
+                setClock(month, 1 + minute % 28, minute / 60, minute % 60);
+                hostStepCount = minute * 37;
+                uint32_t stringsBefore = hostStringAllocs;
+                heapCalls = 0;
+                counting = true;
+                watchy.showWatchFace(frames > 0);
+                counting = false;
+                heap += heapCalls;
+                strings += hostStringAllocs - stringsBefore;
+                frames++;
+            }
+        }
+    }
+    printf("%d frames: %u heap calls, %u String allocations\n", frames, heap, strings);
+    CHECK_EQ(heap, 0);
+    CHECK_EQ(strings, 0);
+
+    // The counters do see allocations
+    uint32_t stringsBefore = hostStringAllocs;
+    heapCalls = 0;
+    counting = true;
+    String text = String("steps ") + String(12345);
+    std::string longText(100, 'x');
+    counting = false;
+    CHECK(hostStringAllocs - stringsBefore >= 3);
+    CHECK(heapCalls > 0);
+    return checkResult();
+}
@@ -0,0 +1,128 @@
+// Golden-image test for the whole face. Every frame of a leap year is rendered and hashed per
+// day: the sun face for all 1440 minutes, and the time/date/stats face in dark mode every hour.
+// The hashes are compared with host/golden/face_hashes.txt; run with --update to rewrite it
+// after an intended change. Frames of the first day that differs are written as PBM for a look.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <host_hw.h>
+#include <string.h>
+
+class FilePrint : public Print {
+    public:
+        explicit FilePrint(FILE *file) : file(file) {}
+        size_t write(uint8_t c) override { return fputc(c, file) == EOF ? 0 : 1; }
+        using Print::write;
+    private:
+        FILE *file;
+};
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+
+void setTime(uint16_t day, uint16_t minute) {
+    tmElements_t yearStart = {};
+    yearStart.Year = CalendarYrToTm(2024);
+    yearStart.Month = 1;
+    yearStart.Day = 1;
+    breakTime(makeTime(yearStart) + day * SECS_PER_DAY + minute * SECS_PER_MIN, watchy.currentTime);
+}
+
+uint64_t hashFrame(uint64_t hash) {
+    // FNV-1a a word at a time; plenty to tell frames apart
+    const uint8_t *buffer = WatchyChron::frame.getBuffer();
+    for (uint16_t i = 0; i < WatchyChron::frame.bufferSize(); i += 8) {
+        uint64_t word = 0;
+        memcpy(&word, buffer + i, min(8, WatchyChron::frame.bufferSize() - i));
+        hash = (hash ^ word) * 1099511628211u;
+    }
+    return hash;
+}
+
+uint32_t sunHash(uint16_t day) {
+    uint64_t hash = 14695981039346656037u;
+    for (uint16_t minute = 0; minute < 1440; minute++) {
+        setTime(day, minute);
+        watchy.renderFace();
+        hash = hashFrame(hash);
+    }
+    return (uint32_t)(hash ^ hash >> 32);
+}
+
+uint32_t timeHash(uint16_t day, int16_t firstBadHour) {
+    uint64_t hash = 14695981039346656037u;
+    showTime = true;
+    showStats = true;
+    darkMode = true;
+    for (uint16_t hour = 0; hour < 24; hour++) {
+        setTime(day, hour * 60 + hour);
+        hostStepCount = day * 100 + hour;
+        hostBatteryVoltage = 3.7 + hour * 0.025;
+        watchy.renderFace();
+        hash = hashFrame(hash);
+        if (hour == firstBadHour) {
+            FILE *file = fopen("time_face.pbm", "wb");
+            FilePrint pbm(file);
+            WatchyChron::frame.writePBM(pbm);
+            fclose(file);
+        }
+    }
+    showTime = false;
+    showStats = false;
+    darkMode = false;
+    return (uint32_t)(hash ^ hash >> 32);
+}
+
+void writeSunFrames(uint16_t day) {
+    // The whole day, as RENDER_SWEEP would send it
+    FILE *file = fopen("sun_face.pbm", "wb");
+    FilePrint out(file);
+    watchy.renderSweep(out, day, day, 1);
+    fclose(file);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s face_hashes.txt [--update]\n", argv[0]);
+        return 2;
+    }
+    bool update = argc > 2 && strcmp(argv[2], "--update") == 0;
+    FILE *golden = fopen(argv[1], update ? "w" : "r");
+    if (!golden) {
+        perror(argv[1]);
+        return 1;
+    }
+    bool written = false;
+    for (uint16_t day = 0; day < 366; day++) {
+        uint32_t sun = sunHash(day);
+        uint32_t time = timeHash(day, -1);
+        if (update) {
+            fprintf(golden, "%u %08x %08x\n", day, sun, time);
+            continue;
+        }
+        unsigned goldenDay, goldenSun, goldenTime;
+        if (fscanf(golden, "%u %x %x", &goldenDay, &goldenSun, &goldenTime) != 3) {
+            fprintf(stderr, "golden file ends at day %u\n", day);
+            checkFailures++;
+            break;
+        }
+        CHECK_EQ(goldenDay, day);
+        if (sun != goldenSun || time != goldenTime) {
+            fprintf(stderr, "day %u: sun %08x (golden %08x), time %08x (golden %08x)\n", day, sun, goldenSun,
+                    time, goldenTime);
+            checkFailures++;
+            if (!written) {
+                writeSunFrames(day);
+                timeHash(day, 0);
+                fprintf(stderr, "wrote sun_face.pbm and time_face.pbm for day %u\n", day);
+                written = true;
+            }
+        }
+    }
+    fclose(golden);
+    if (update) {
+        printf("wrote %s\n", argv[1]);
+        return 0;
+    }
+    return checkResult();
+}
@@ -0,0 +1,64 @@
+// Stage timing rings (min/mean/max across wraparound), reset from the timing screen, and the
+// panel byte counts in the serial dump.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+
+class StringPrint : public Print {
+    public:
+        std::string text;
+        size_t write(uint8_t c) override {
+            text += (char)c;
+            return 1;
+        }
+        using Print::write;
+};
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+
+void addSample(FrameStage stage, uint32_t micros) {
+    // The host clock is real, so fake the elapsed time by backdating the start
+    timingBegin(stage);
+    extern uint32_t stageStarts[STAGE_COUNT];
+    stageStarts[stage] = timingNowMicros() - micros;
+    timingEnd(stage);
+}
+
+int main() {
+    timingReset();
+    StageStats empty = timingStats(STAGE_SUN);
+    CHECK_EQ(empty.count, 0);
+
+    addSample(STAGE_SUN, 5000);
+    for (uint8_t i = 0; i < TIMING_RING_LENGTH; i++) {
+        addSample(STAGE_SUN, 1000 + i);
+    }
+    StageStats sun = timingStats(STAGE_SUN);
+    CHECK_EQ(sun.count, TIMING_RING_LENGTH);
+    // The 5 ms sample has left the ring but stays the all-time max
+    CHECK(sun.max >= 5000);
+    CHECK(sun.min >= 1000 && sun.min < 1010);
+    CHECK(sun.mean >= 1007 && sun.mean < 1020);
+    CHECK(sun.last >= 1015 && sun.last < 1025);
+
+    timingPanelPush(200, 200);
+    timingPanelPush(33, 10);
+    StringPrint csv;
+    writeFrameTiming(csv);
+    CHECK(csv.text.find("sun,") != std::string::npos);
+    CHECK(csv.text.find("panel,50,5050,2") != std::string::npos);
+
+    // MENU on the timing screen starts the stats afresh
+    watchy.showFrameTiming();
+    CHECK_EQ(guiState, TIMING_STATE);
+    watchy.dispatchButton(BUTTON_MENU);
+    CHECK_EQ(timingStats(STAGE_SUN).count, 0);
+    csv.text.clear();
+    writeFrameTiming(csv);
+    CHECK(csv.text.find("panel,0,0,0") != std::string::npos);
+    CHECK_EQ(guiState, TIMING_STATE);
+    watchy.dispatchButton(BUTTON_BACK);
+    CHECK_EQ(guiState, MAIN_MENU_STATE);
+    return checkResult();
+}
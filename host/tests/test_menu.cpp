@@ -0,0 +1,52 @@
+// Menu items that run library screens (setTime, showAccelerometer) end on the library's own
+// menu. Moving the selection afterwards must still leave our menu on the panel, exactly as a
+// fresh full draw would.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+WatchyDisplay &epd = Watchy::display.epd2;
+
+uint8_t expectedPanel[sizeof(epd.panel)];
+
+// Panel after a full draw of our menu with item selected
+void drawExpected(uint8_t item) {
+    listViewInvalidate();
+    watchy.showMenu(item, false);
+    memcpy(expectedPanel, epd.panel, sizeof(epd.panel));
+}
+
+void checkLibraryItem(uint8_t item) {
+    drawExpected(item + 1);
+    menuIndex = item;
+    watchy.showMenu(menuIndex, false);
+    watchy.dispatchButton(BUTTON_MENU);
+    CHECK_EQ(guiState, MAIN_MENU_STATE);
+    // Next item down, with the fast partial update
+    menuIndex = item + 1;
+    epd.resetCounters();
+    watchy.showPendingList();
+    CHECK_EQ(epd.fullRefreshes, 0);
+    CHECK(memcmp(epd.panel, expectedPanel, sizeof(epd.panel)) == 0);
+}
+
+int main() {
+    checkLibraryItem(2); // Show Accelerometer
+    checkLibraryItem(3); // Set Time
+
+    // Firmware update screens belong to the library too
+    drawExpected(6);
+    menuIndex = 5;
+    watchy.showMenu(menuIndex, false);
+    watchy.dispatchButton(BUTTON_MENU);
+    CHECK_EQ(guiState, FW_UPDATE_STATE);
+    watchy.dispatchButton(BUTTON_MENU);
+    watchy.dispatchButton(BUTTON_BACK);
+    CHECK_EQ(guiState, MAIN_MENU_STATE);
+    menuIndex = 6;
+    watchy.showPendingList();
+    CHECK(memcmp(epd.panel, expectedPanel, sizeof(epd.panel)) == 0);
+    return checkResult();
+}
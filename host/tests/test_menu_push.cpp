@@ -0,0 +1,69 @@
+// Bytes sent to the panel for menu moves, counted by the stand-in driver: one step repaints only
+// the two row bands, and quick presses are batched into one partial push.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <host_hw.h>
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+WatchyDisplay &epd = Watchy::display.epd2;
+
+// GxEPD2's displayWindow and display both write the controller RAM twice, around the refresh
+#define WRITES_PER_PUSH 2
+#define BYTES_PER_LINE (DISPLAY_WIDTH / 8)
+#define FULL_PUSH_BYTES (WRITES_PER_PUSH * BYTES_PER_LINE * DISPLAY_HEIGHT)
+
+// Menu on the panel with item selected, counters cleared
+void showMenuAt(uint8_t item) {
+    listViewInvalidate();
+    menuIndex = item;
+    watchy.showMenu(item, false);
+    epd.resetCounters();
+}
+
+void checkStep() {
+    // Down from the second row: rows 1 and 2, MENU_HEIGHT each, full width
+    showMenuAt(1);
+    watchy.dispatchButton(BUTTON_DOWN);
+    watchy.showPendingList();
+    CHECK_EQ(menuIndex, 2);
+    CHECK_EQ(epd.fullRefreshes, 0);
+    CHECK_EQ(epd.partialRefreshes, 1);
+    CHECK_EQ(epd.bytesWritten, (uint32_t)(WRITES_PER_PUSH * BYTES_PER_LINE * 2 * MENU_HEIGHT));
+    printf("one step: %u bytes, a full push is %u\n", epd.bytesWritten, FULL_PUSH_BYTES);
+
+    // Paging onto the next page is a full push
+    showMenuAt(MENU_LENGTH - 1);
+    watchy.dispatchButton(BUTTON_DOWN);
+    watchy.showPendingList();
+    CHECK_EQ(epd.fullRefreshes, 1);
+    CHECK_EQ(epd.bytesWritten, (uint32_t)FULL_PUSH_BYTES);
+}
+
+void checkBatch() {
+    // Four quick taps of DOWN 70 ms apart, the first one waking the watch: each lands inside
+    // the FAST_BATCH_MS window of the one before, so the panel is pushed once, for rows 0 to 4
+    const HostPinEvent taps[] = {
+        {0, DOWN_BTN_PIN, HIGH}, {35, DOWN_BTN_PIN, LOW}, {70, DOWN_BTN_PIN, HIGH}, {105, DOWN_BTN_PIN, LOW},
+        {140, DOWN_BTN_PIN, HIGH}, {175, DOWN_BTN_PIN, LOW}, {210, DOWN_BTN_PIN, HIGH}, {245, DOWN_BTN_PIN, LOW},
+    };
+    showMenuAt(0);
+    hostSetMillis(0);
+    hostSetPin(taps[0].pin, taps[0].level);
+    hostWakeupCause = ESP_SLEEP_WAKEUP_EXT1;
+    hostExt1Status = 1ULL << taps[0].pin;
+    hostPlayTimeline(taps + 1, sizeof(taps) / sizeof(taps[0]) - 1);
+    watchy.handleButtonPress();
+    CHECK_EQ(menuIndex, 4);
+    CHECK_EQ(epd.fullRefreshes, 0);
+    CHECK_EQ(epd.partialRefreshes, 1);
+    CHECK_EQ(epd.bytesWritten, (uint32_t)(WRITES_PER_PUSH * BYTES_PER_LINE * 5 * MENU_HEIGHT));
+    printf("four taps: %u partial push, %u bytes\n", epd.partialRefreshes, epd.bytesWritten);
+}
+
+int main() {
+    checkStep();
+    checkBatch();
+    return checkResult();
+}
@@ -0,0 +1,62 @@
+// orbit_lookup.h against the float formula drawSun used before the table, for every minute.
+
+#include <Arduino.h>
+#include "orbit_lookup.h"
+#include "check.h"
+
+struct Orbit {
+    int sunX, sunY, moonX, moonY;
+};
+
+// Baseline drawSun: angle in double, stored as float, float cos/sin, truncated to int
+Orbit floatOrbit(int minute) {
+    const uint8_t border_radius = 200 / 2 - 4 / 2;
+    float currentMinute = minute;
+    float angle = (currentMinute - 360) / 1440.0 * TWO_PI;
+    Orbit orbit;
+    orbit.sunX = 100 + border_radius * cos(angle) - (65 / 2);
+    orbit.sunY = 100 - border_radius * sin(angle) - (65 / 2);
+    orbit.moonX = 100 + border_radius * cos(angle) - (33 / 2);
+    orbit.moonY = 100 - border_radius * sin(angle) - (33 / 2);
+    return orbit;
+}
+
+Orbit tableOrbit(int minute) {
+    const uint8_t *row = orbitLookup[minute];
+    return {row[ORBIT_SUN_X] - ORBIT_SUN_OFFSET, row[ORBIT_SUN_Y] - ORBIT_SUN_OFFSET,
+            row[ORBIT_MOON_X] - ORBIT_MOON_OFFSET, row[ORBIT_MOON_Y] - ORBIT_MOON_OFFSET};
+}
+
+int main() {
+    // Where the exact position is a whole pixel (cos or sin is 0 or +-0.5), float rounding
+    // lands just under it and truncates 1px low; the table has the exact value
+    struct {
+        int minute, dx, dy;
+    } exact[] = {{0, 1, 0}, {12 * 60, 1, 0}, {14 * 60, 1, 0}, {16 * 60, 0, 1}};
+
+    int differing = 0;
+    for (int minute = 0; minute < 1440; minute++) {
+        Orbit expected = floatOrbit(minute);
+        for (auto &e : exact) {
+            if (e.minute == minute) {
+                expected.sunX += e.dx;
+                expected.moonX += e.dx;
+                expected.sunY += e.dy;
+                expected.moonY += e.dy;
+                differing++;
+            }
+        }
+        Orbit got = tableOrbit(minute);
+        CHECK_EQ(got.sunX, expected.sunX);
+        CHECK_EQ(got.sunY, expected.sunY);
+        CHECK_EQ(got.moonX, expected.moonX);
+        CHECK_EQ(got.moonY, expected.moonY);
+    }
+    CHECK_EQ(differing, 4);
+
+    volatile int sink = 0;
+    double floatMicros = benchMicros(1440, [&](int minute) { sink += floatOrbit(minute).sunX; });
+    double tableMicros = benchMicros(1440, [&](int minute) { sink += tableOrbit(minute).sunX; });
+    printf("float %.3f us, table %.3f us per minute (host)\n", floatMicros, tableMicros);
+    return checkResult();
+}
@@ -0,0 +1,85 @@
+// rasterOp must give the same bytes as combining one byte at a time, for every op, with and
+// without a source, for any size and at any offset into either buffer.
+
+#include "frame_buffer.h"
+#include "static_layer.h"
+#include "check.h"
+#include <vector>
+
+#define BUFFER_SIZE (200 * 200 / 8)
+
+uint8_t referenceByte(uint8_t dest, uint8_t src, RasterOp op) {
+    switch (op) {
+        case ROP_AND:
+            return dest & src;
+        case ROP_OR:
+            return dest | src;
+        case ROP_XOR:
+            return dest ^ src;
+        default:
+            return dest & ~src;
+    }
+}
+
+void referenceOp(uint8_t *dest, const uint8_t *src, uint16_t size, RasterOp op) {
+    for (uint16_t i = 0; i < size; i++) {
+        dest[i] = referenceByte(dest[i], src ? src[i] : 0xFF, op);
+    }
+}
+
+int main() {
+    srand(5);
+    std::vector<uint8_t> background(BUFFER_SIZE + 8);
+    std::vector<uint8_t> source(BUFFER_SIZE + 8);
+    for (uint16_t i = 0; i < background.size(); i++) {
+        background[i] = rand();
+        source[i] = rand();
+    }
+    const uint16_t sizes[] = {0, 1, 3, 4, 5, 7, 8, 9, 31, 200, BUFFER_SIZE - 1, BUFFER_SIZE};
+    const RasterOp ops[] = {ROP_AND, ROP_OR, ROP_XOR, ROP_ANDNOT};
+    int runs = 0;
+    int wrong = 0;
+    for (RasterOp op : ops) {
+        for (uint16_t size : sizes) {
+            for (uint8_t destOffset = 0; destOffset < 4; destOffset++) {
+                for (int8_t srcOffset = -1; srcOffset < 4; srcOffset++) {
+                    // srcOffset -1 is no source
+                    const uint8_t *src = srcOffset < 0 ? NULL : source.data() + srcOffset;
+                    std::vector<uint8_t> fast = background;
+                    std::vector<uint8_t> reference = background;
+                    rasterOp(fast.data() + destOffset, src, size, op);
+                    referenceOp(reference.data() + destOffset, src, size, op);
+                    // Bytes either side of dest are untouched too
+                    wrong += fast != reference;
+                    runs++;
+                }
+            }
+        }
+    }
+    printf("%d raster ops compared\n", runs);
+    CHECK_EQ(wrong, 0);
+
+    // Inverting the static layer twice gives it back, and its key bits
+    FrameBuffer frame(200, 200);
+    memcpy(frame.getBuffer(), background.data(), BUFFER_SIZE);
+    staticLayerSave(frame, 6);
+    staticLayerInvert(1);
+    CHECK(staticLayerRestore(frame, 7));
+    std::vector<uint8_t> inverted(background.begin(), background.begin() + BUFFER_SIZE);
+    referenceOp(inverted.data(), NULL, BUFFER_SIZE, ROP_XOR);
+    CHECK(memcmp(frame.getBuffer(), inverted.data(), BUFFER_SIZE) == 0);
+    staticLayerInvert(1);
+    CHECK(staticLayerRestore(frame, 6));
+    CHECK(memcmp(frame.getBuffer(), background.data(), BUFFER_SIZE) == 0);
+
+    // Per whole frame
+    std::vector<uint8_t> dest = background;
+    double bytes = benchMicros(20000, [&](int i) {
+        referenceOp(dest.data(), source.data(), BUFFER_SIZE, ops[i & 3]);
+    });
+    double words = benchMicros(20000, [&](int i) {
+        rasterOp(dest.data(), source.data(), BUFFER_SIZE, ops[i & 3]);
+    });
+    printf("frame: %.2f us a byte at a time, %.2f us through rasterOp\n", bytes, words);
+    return checkResult();
+}
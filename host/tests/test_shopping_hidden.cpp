@@ -0,0 +1,105 @@
+// Hiding checked items: the n-th unchecked item from the block counts must agree with a plain
+// scan, and the list screen with checked items hidden must show only those, with the count.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <string>
+#include <vector>
+
+#define HIDDEN_LIST_ITEMS 1500
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+
+extern bool hideChecked;
+extern char shoppingBadge[];
+const char *listItemText(uint16_t index);
+
+std::vector<bool> model;
+
+int checkSelect() {
+    // Every n against a scan of the model; returns how many disagree
+    int wrong = 0;
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < model.size(); i++) {
+        if (!model[i]) {
+            wrong += shoppingListUnchecked(n++) != i;
+        }
+    }
+    wrong += shoppingListRemaining() != n;
+    wrong += shoppingListUnchecked(n) != model.size();
+    wrong += shoppingListUnchecked(0xFFFF) != model.size();
+    return wrong;
+}
+
+void toggle(uint16_t index) {
+    shoppingListToggle(index);
+    model[index] = !model[index];
+}
+
+int main() {
+    remove("shopping.lst");
+    remove("shopping.chk");
+    std::vector<std::string> texts;
+    std::vector<const char *> items;
+    for (uint16_t i = 0; i < HIDDEN_LIST_ITEMS; i++) {
+        texts.push_back("item " + std::to_string(i));
+    }
+    for (const std::string &text : texts) {
+        items.push_back(text.c_str());
+    }
+    CHECK(shoppingListWrite(items.data(), HIDDEN_LIST_ITEMS));
+    model.assign(HIDDEN_LIST_ITEMS, false);
+    CHECK_EQ(checkSelect(), 0);
+
+    // Whole blocks checked, the edges of blocks and bytes, and the last item
+    for (uint16_t i = SHOPPING_BLOCK_ITEMS; i < 2 * SHOPPING_BLOCK_ITEMS; i++) {
+        toggle(i);
+    }
+    toggle(0);
+    toggle(7);
+    toggle(8);
+    toggle(SHOPPING_BLOCK_ITEMS - 1);
+    toggle(HIDDEN_LIST_ITEMS - 1);
+    CHECK_EQ(checkSelect(), 0);
+    // Random marks, some pending and some flushed
+    srand(2);
+    for (int round = 0; round < 4; round++) {
+        for (int i = 0; i < 200; i++) {
+            toggle(rand() % HIDDEN_LIST_ITEMS);
+        }
+        CHECK_EQ(checkSelect(), 0);
+        shoppingListFlush();
+        CHECK_EQ(checkSelect(), 0);
+    }
+    double perSelect = benchMicros(100000, [](int i) {
+        shoppingListUnchecked(i % shoppingListRemaining());
+    });
+    printf("%.3f us per unchecked lookup\n", perSelect);
+
+    // The list screen with checked items hidden
+    guiState = MAIN_MENU_STATE;
+    menuIndex = CHRON_MENU_LENGTH - 1;
+    hideChecked = false;
+    watchy.dispatchButton(BUTTON_MENU);
+    CHECK_EQ(guiState, SHOPLIST_STATE);
+    CHECK(hideChecked);
+    char badge[16];
+    snprintf(badge, sizeof(badge), "%u left", shoppingListRemaining());
+    CHECK(strcmp(shoppingBadge, badge) == 0);
+    uint16_t first = shoppingListUnchecked(0);
+    CHECK(texts[first] == listItemText(0));
+    CHECK(texts[shoppingListUnchecked(1)] == listItemText(1));
+
+    // Checking the top row takes it out of view and shows the next unchecked item
+    uint16_t second = shoppingListUnchecked(1);
+    watchy.dispatchButton(BUTTON_MENU);
+    model[first] = true;
+    CHECK(shoppingListChecked(first));
+    CHECK(texts[second] == listItemText(0));
+    watchy.showPendingList();
+    snprintf(badge, sizeof(badge), "%u left", shoppingListRemaining());
+    CHECK(strcmp(shoppingBadge, badge) == 0);
+    CHECK_EQ(checkSelect(), 0);
+    return checkResult();
+}
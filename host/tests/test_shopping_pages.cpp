@@ -0,0 +1,225 @@
+// Long shopping lists: pages streamed through the offset index on a 10k-item list, check
+// marks that live in flash with only pending toggles in RTC memory, reads of them straight
+// after a wake, version 1 migration, and damaged files reported instead of replaced or read
+// past their ends.
+
+#include "shopping_list.h"
+#include "check.h"
+#include <host_hw.h>
+#include <string>
+#include <vector>
+
+#define LONG_LIST_ITEMS 10000
+#define PAGE_ROWS 7
+
+// RTC memory; clearing shoppingLoaded is what a cold boot does
+extern bool shoppingLoaded;
+extern uint8_t shoppingPendingCount;
+// RAM
+extern bool shoppingMounted;
+extern uint16_t checkCacheBlock;
+extern uint16_t windowCount;
+
+std::string itemText(uint16_t i) {
+    char text[SHOPPING_ITEM_MAX_LEN + 1];
+    // Lengths vary so the index offsets are not all the same distance apart
+    snprintf(text, sizeof(text), "item %u%.*s", i, i % 13, "-------------");
+    return text;
+}
+
+void writeBytes(const char *path, const std::string &bytes) {
+    FILE *f = fopen(path, "wb");
+    fwrite(bytes.data(), 1, bytes.size(), f);
+    fclose(f);
+}
+
+std::string uint16Bytes(uint16_t value) {
+    return std::string(1, (char)(value & 0xFF)) + (char)(value >> 8);
+}
+
+void checkLongList() {
+    std::vector<std::string> texts;
+    std::vector<const char *> items;
+    for (uint16_t i = 0; i < LONG_LIST_ITEMS; i++) {
+        texts.push_back(itemText(i));
+    }
+    for (const std::string &text : texts) {
+        items.push_back(text.c_str());
+    }
+    CHECK(shoppingListWrite(items.data(), LONG_LIST_ITEMS));
+    CHECK_EQ(shoppingListLength(), LONG_LIST_ITEMS);
+
+    // Every item, forwards and backwards
+    int wrong = 0;
+    for (int i = 0; i < LONG_LIST_ITEMS; i++) {
+        wrong += texts[i] != shoppingListItem(i);
+    }
+    for (int i = LONG_LIST_ITEMS - 1; i >= 0; i--) {
+        wrong += texts[i] != shoppingListItem(i);
+    }
+    CHECK_EQ(wrong, 0);
+
+    // Toggles on far apart items: more than fit in RTC memory, so some go to flash early
+    std::vector<bool> model(LONG_LIST_ITEMS);
+    for (uint32_t i = 0; i < 3 * SHOPPING_PENDING_TOGGLES; i++) {
+        uint16_t index = (i * 7919) % LONG_LIST_ITEMS;
+        shoppingListToggle(index);
+        model[index] = !model[index];
+        CHECK(shoppingPendingCount <= SHOPPING_PENDING_TOGGLES);
+    }
+    shoppingListToggle(7919 % LONG_LIST_ITEMS); // and one back
+    model[7919 % LONG_LIST_ITEMS] = false;
+    uint16_t checked = 0;
+    for (int i = 0; i < LONG_LIST_ITEMS; i++) {
+        wrong += shoppingListChecked(i) != model[i];
+        checked += model[i];
+    }
+    CHECK_EQ(wrong, 0);
+    CHECK_EQ(shoppingListRemaining(), LONG_LIST_ITEMS - checked);
+    shoppingListFlush();
+    CHECK_EQ(shoppingPendingCount, 0);
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    for (int i = 0; i < LONG_LIST_ITEMS; i++) {
+        wrong += shoppingListChecked(i) != model[i];
+    }
+    CHECK_EQ(wrong, 0);
+    CHECK_EQ(shoppingListRemaining(), LONG_LIST_ITEMS - checked);
+
+    // Page flips to pages all over the list, each one a fresh read from the file
+    srand(1);
+    double perPage = benchMicros(2000, [&](int i) {
+        uint16_t top = rand() % (LONG_LIST_ITEMS - PAGE_ROWS);
+        for (uint16_t row = 0; row < PAGE_ROWS; row++) {
+            wrong += shoppingListItem(top + row)[0] != 'i';
+            shoppingListChecked(top + row);
+        }
+    });
+    CHECK_EQ(wrong, 0);
+    // Stepping through the list a page at a time
+    double perStep = benchMicros(LONG_LIST_ITEMS / PAGE_ROWS, [&](int page) {
+        for (uint16_t row = 0; row < PAGE_ROWS; row++) {
+            wrong += shoppingListItem(page * PAGE_ROWS + row)[0] != 'i';
+            shoppingListChecked(page * PAGE_ROWS + row);
+        }
+    });
+    CHECK_EQ(wrong, 0);
+    printf("%d items: %.2f us per random page, %.2f us per next page\n", LONG_LIST_ITEMS, perPage, perStep);
+}
+
+// A wake from deep sleep: the loaded list, the counts and the pending toggles are in RTC
+// memory, but LittleFS isn't mounted and the RAM caches are gone
+void simulateWake() {
+    shoppingMounted = false;
+    hostFsMounted = false;
+    checkCacheBlock = 0xFFFF;
+    windowCount = 0;
+}
+
+void checkWake() {
+    const char *items[] = {"bread", "milk", "eggs", "tea", "jam"};
+    CHECK(shoppingListWrite(items, 5));
+    shoppingListToggle(1);
+    shoppingListToggle(3);
+    shoppingListFlush();
+
+    // MENU on the list is the button that woke the watch: a checked item is toggled before
+    // anything else has touched flash
+    simulateWake();
+    CHECK(shoppingListBegin());
+    shoppingListToggle(1);
+    CHECK(!shoppingListChecked(1));
+    CHECK_EQ(shoppingListRemaining(), 4);
+    shoppingListFlush();
+
+    // Rows with checked items hidden, straight after a wake
+    simulateWake();
+    const uint16_t unchecked[] = {0, 1, 2, 4};
+    for (uint16_t n = 0; n < 4; n++) {
+        CHECK_EQ(shoppingListUnchecked(n), unchecked[n]);
+    }
+    CHECK_EQ(shoppingListUnchecked(4), 5);
+
+    // The counts still match flash on a cold boot
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK_EQ(shoppingListRemaining(), 4);
+    CHECK(!shoppingListChecked(1));
+    CHECK(shoppingListChecked(3));
+
+    // Check marks that can't be read aren't guessed at: the toggle is refused, and the failed
+    // read isn't cached as nothing checked
+    simulateWake();
+    rename("shopping.chk", "shopping.chk.away");
+    shoppingListToggle(3);
+    CHECK_EQ(shoppingListRemaining(), 4);
+    rename("shopping.chk.away", "shopping.chk");
+    CHECK(shoppingListChecked(3));
+    CHECK_EQ(shoppingListUnchecked(3), 4);
+}
+
+void checkMigration() {
+    // A version 1 list: no index, records straight after the header, marks that still apply
+    std::string v1 = std::string("SL\x01", 3) + uint16Bytes(10);
+    for (uint16_t i = 0; i < 10; i++) {
+        v1 += (char)itemText(i).size() + itemText(i);
+    }
+    writeBytes("shopping.lst", v1);
+    writeBytes("shopping.chk", uint16Bytes(10) + "\x05\x02");
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK_EQ(shoppingListLength(), 10);
+    for (uint16_t i = 0; i < 10; i++) {
+        CHECK(itemText(i) == shoppingListItem(i));
+        CHECK_EQ(shoppingListChecked(i), i == 0 || i == 2 || i == 9);
+    }
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK(itemText(9) == shoppingListItem(9));
+    FILE *f = fopen("shopping.lst", "rb");
+    CHECK_EQ(fgetc(f), 'S');
+    CHECK_EQ(fgetc(f), 'L');
+    CHECK_EQ(fgetc(f), 2);
+    fclose(f);
+}
+
+void checkDamage() {
+    // A header we don't know: an error, and the file stays as it was
+    const std::string unknown = std::string("SL\x09", 3) + uint16Bytes(1) + "\x01x";
+    writeBytes("shopping.lst", unknown);
+    shoppingLoaded = false;
+    CHECK(!shoppingListBegin());
+    CHECK_EQ(shoppingListLength(), 0);
+    FILE *f = fopen("shopping.lst", "rb");
+    char bytes[16];
+    CHECK_EQ(fread(bytes, 1, sizeof(bytes), f), unknown.size());
+    fclose(f);
+    CHECK(unknown.compare(0, unknown.size(), bytes, unknown.size()) == 0);
+
+    // Record lengths past SHOPPING_ITEM_MAX_LEN, and a file cut short: items read as empty
+    std::string list = std::string("SL\x02", 3) + uint16Bytes(3) + std::string("\x09\0\0\0", 4);
+    list += "\x02" "ok" "\xff" "overflow";
+    writeBytes("shopping.lst", list);
+    writeBytes("shopping.chk", uint16Bytes(3) + std::string(1, '\0'));
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK(strcmp(shoppingListItem(0), "ok") == 0);
+    CHECK(strcmp(shoppingListItem(1), "") == 0);
+    CHECK(strcmp(shoppingListItem(2), "") == 0);
+
+    // Only a missing list is replaced with the sample
+    remove("shopping.lst");
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK_EQ(shoppingListLength(), 14);
+}
+
+int main() {
+    remove("shopping.lst");
+    remove("shopping.chk");
+    checkLongList();
+    checkWake();
+    checkMigration();
+    checkDamage();
+    return checkResult();
+}
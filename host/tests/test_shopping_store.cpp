@@ -0,0 +1,84 @@
+// The shopping list on its file-backed stand-in: the record format on disk, check marks that
+// survive a cold boot, and toggles that stay in RTC memory until the flush.
+
+#include "shopping_list.h"
+#include "check.h"
+#include <string>
+
+// RTC memory; clearing it is what a cold boot does
+extern bool shoppingLoaded;
+
+std::string readFile(const char *path) {
+    std::string bytes;
+    FILE *f = fopen(path, "rb");
+    if (f) {
+        int c;
+        while ((c = fgetc(f)) != EOF) {
+            bytes += (char)c;
+        }
+        fclose(f);
+    }
+    return bytes;
+}
+
+int main() {
+    remove("shopping.lst");
+    remove("shopping.chk");
+
+    // The first open seeds the sample list
+    CHECK(shoppingListBegin());
+    CHECK_EQ(shoppingListLength(), 14);
+    CHECK(strcmp(shoppingListItem(0), "3 red capsicum") == 0);
+
+    const char *items[] = {"milk", "", "a long item that is cut at thirty-one characters"};
+    CHECK(shoppingListWrite(items, 3));
+    // "SL", version, count, one index entry, then length-prefixed records
+    std::string list = readFile("shopping.lst");
+    CHECK_EQ(list.size(), 5 + 4 + (1 + 4) + 1 + (1 + SHOPPING_ITEM_MAX_LEN));
+    CHECK(list.compare(0, 3, "SL\x02") == 0);
+    CHECK_EQ((uint8_t)list[3] | (uint8_t)list[4] << 8, 3);
+    CHECK_EQ((uint8_t)list[9], 4);
+    CHECK(list.compare(10, 4, "milk") == 0);
+    CHECK_EQ((uint8_t)list[15], SHOPPING_ITEM_MAX_LEN);
+    CHECK_EQ(shoppingListLength(), 3);
+    CHECK(strcmp(shoppingListItem(1), "") == 0);
+    CHECK_EQ(strlen(shoppingListItem(2)), SHOPPING_ITEM_MAX_LEN);
+    CHECK(strcmp(shoppingListItem(3), "") == 0); // past the end
+
+    // Toggles only touch flash on the flush
+    std::string checks = readFile("shopping.chk");
+    CHECK_EQ(checks.size(), 3u);
+    CHECK_EQ(checks[2], 0);
+    shoppingListToggle(0);
+    shoppingListToggle(2);
+    shoppingListToggle(2);
+    shoppingListToggle(2);
+    shoppingListToggle(3); // past the end, ignored
+    CHECK(shoppingListChecked(0));
+    CHECK(!shoppingListChecked(1));
+    CHECK(shoppingListChecked(2));
+    CHECK(readFile("shopping.chk") == checks);
+    shoppingListFlush();
+    CHECK_EQ(readFile("shopping.chk")[2], 0x05);
+
+    // Marks survive a cold boot, which reads them back from flash
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK_EQ(shoppingListLength(), 3);
+    CHECK(shoppingListChecked(0));
+    CHECK(!shoppingListChecked(1));
+    CHECK(shoppingListChecked(2));
+    CHECK(strcmp(shoppingListItem(0), "milk") == 0);
+
+    // Marks saved for a list of another length are dropped
+    FILE *f = fopen("shopping.chk", "wb");
+    fputc(2, f);
+    fputc(0, f);
+    fputc(0x03, f);
+    fclose(f);
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK(!shoppingListChecked(0));
+    CHECK(!shoppingListChecked(1));
+    return checkResult();
+}
@@ -0,0 +1,168 @@
+// Shopping list sync: edit scripts applied directly, then the Sync List screen driven by the
+// stand-in HTTP client in WebServer.h, and its storage error ahead of the Wi-Fi one.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <WebServer.h>
+#include <string>
+
+#define SYNC_LIST_ITEMS 10000
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+WatchyDisplay &epd = Watchy::display.epd2;
+
+extern bool shoppingLoaded;
+
+std::string baseLine() {
+    char line[16];
+    snprintf(line, sizeof(line), "base %08x\n", shoppingListHash());
+    return line;
+}
+
+bool exists(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f) {
+        fclose(f);
+    }
+    return f;
+}
+
+ShoppingSyncResult apply(const std::string &script) {
+    return shoppingListApply(script.data(), script.size());
+}
+
+void checkScripts() {
+    const char *items[] = {"bread", "milk", "eggs", "tea", "jam"};
+    CHECK(shoppingListWrite(items, 5));
+    shoppingListToggle(0);
+    shoppingListToggle(3);
+
+    // Keep two, drop one, insert one, keep the rest; marks stay on the items they were on
+    CHECK_EQ(apply(baseLine() + "= 2\n- 1\n+ butter\n= 2\n"), SYNC_OK);
+    const char *edited[] = {"bread", "milk", "butter", "tea", "jam"};
+    const bool checked[] = {true, false, false, true, false};
+    CHECK_EQ(shoppingListLength(), 5);
+    for (uint16_t i = 0; i < 5; i++) {
+        CHECK(strcmp(shoppingListItem(i), edited[i]) == 0);
+        CHECK_EQ(shoppingListChecked(i), checked[i]);
+    }
+    CHECK_EQ(shoppingListRemaining(), 3);
+    // Everything reached flash
+    shoppingLoaded = false;
+    CHECK(shoppingListBegin());
+    CHECK(strcmp(shoppingListItem(2), "butter") == 0);
+    CHECK(shoppingListChecked(3));
+
+    // Rejected scripts leave the list alone
+    uint32_t hash = shoppingListHash();
+    CHECK_EQ(apply("base 00000000\n+ x\n"), SYNC_STALE);
+    CHECK_EQ(apply(baseLine() + "= 6\n"), SYNC_BAD_SCRIPT);
+    CHECK_EQ(apply(baseLine() + "? 1\n"), SYNC_BAD_SCRIPT);
+    CHECK_EQ(apply(baseLine() + "+ " + std::string(SHOPPING_ITEM_MAX_LEN + 1, 'x') + "\n"), SYNC_BAD_SCRIPT);
+    CHECK_EQ(apply("+ x\n"), SYNC_BAD_SCRIPT);
+    CHECK_EQ(shoppingListHash(), hash);
+    CHECK(shoppingListChecked(0));
+    CHECK(!exists("shopping.new"));
+    CHECK(!exists("shopping.chn"));
+
+    // A full upload of a long list, then one more item than fits
+    std::string upload = baseLine();
+    for (int i = 0; i < SYNC_LIST_ITEMS; i++) {
+        upload += "+ item " + std::to_string(i) + "\n";
+    }
+    CHECK_EQ(apply(upload), SYNC_OK);
+    CHECK_EQ(shoppingListLength(), SYNC_LIST_ITEMS);
+    CHECK(strcmp(shoppingListItem(SYNC_LIST_ITEMS - 1), "item 9999") == 0);
+    CHECK_EQ(shoppingListRemaining(), SYNC_LIST_ITEMS);
+    std::string tooLong = baseLine();
+    for (int i = 0; i <= SHOPPING_LIST_MAX_ITEMS; i++) {
+        tooLong += "+ x\n";
+    }
+    CHECK_EQ(apply(tooLong), SYNC_BAD_SCRIPT);
+    CHECK_EQ(shoppingListLength(), SYNC_LIST_ITEMS);
+}
+
+void checkServer() {
+    const char *items[] = {"apples", "pears"};
+    CHECK(shoppingListWrite(items, 2));
+    shoppingListToggle(1);
+    char hash[16];
+    snprintf(hash, sizeof(hash), "%08x\n", shoppingListHash());
+    WIFI_CONFIGURED = true;
+    hostHttpServed.clear();
+    hostHttpRequests = {
+        {HTTP_GET, "/list", "", 0, ""},
+        {HTTP_POST, "/list", "base 00000000\n+ figs\n", 0, ""},
+        {HTTP_POST, "/list", "base\n", 0, ""},
+        {HTTP_POST, "/list", std::string("base ") + hash + "= 2\n+ figs\n", 0, ""},
+        {HTTP_GET, "/list", "", 0, ""}, // never served: the screen stops once a list arrives
+    };
+    watchy.showSyncList();
+    CHECK_EQ(hostHttpServed.size(), 4u);
+    CHECK_EQ(hostHttpRequests.size(), 1u);
+    if (hostHttpServed.size() == 4) {
+        CHECK_EQ(hostHttpServed[0].code, 200);
+        CHECK(hostHttpServed[0].response == std::string(hash) + "apples\npears\n");
+        CHECK_EQ(hostHttpServed[1].code, 409);
+        CHECK_EQ(hostHttpServed[2].code, 400);
+        CHECK_EQ(hostHttpServed[3].code, 200);
+        CHECK(hostHttpServed[3].response == "3 items\n");
+    }
+    CHECK_EQ(shoppingListLength(), 3);
+    CHECK(strcmp(shoppingListItem(2), "figs") == 0);
+    CHECK(shoppingListChecked(1));
+}
+
+// Panel after the Sync List screen stopped with message
+void drawStopped(const char *message) {
+    GxEPD2_BW<WatchyDisplay, WatchyDisplay::HEIGHT> &display = Watchy::display;
+    display.setFullWindow();
+    display.fillScreen(GxEPD_BLACK);
+    display.setFont(&FreeMonoBold9pt7b);
+    display.setTextColor(GxEPD_WHITE);
+    display.setCursor(0, 30);
+    display.println("Sync List");
+    display.println(message);
+    if (strcmp(message, "No WiFi, try") == 0) {
+        display.println("Setup WiFi first");
+    }
+    display.display(false);
+}
+
+void checkErrors() {
+    static uint8_t expected[sizeof(epd.panel)];
+    // A list that can't be read says so, even with Wi-Fi set up
+    FILE *f = fopen("shopping.lst", "wb");
+    fputs("SL?", f);
+    fclose(f);
+    shoppingLoaded = false;
+    WIFI_CONFIGURED = true;
+    hostHttpRequests = {{HTTP_GET, "/list", "", 0, ""}};
+    drawStopped("Storage error");
+    memcpy(expected, epd.panel, sizeof(expected));
+    memset(epd.panel, 0, sizeof(epd.panel));
+    watchy.showSyncList();
+    CHECK(memcmp(epd.panel, expected, sizeof(expected)) == 0);
+    CHECK_EQ(hostHttpRequests.size(), 1u);
+
+    // A good list without Wi-Fi
+    remove("shopping.lst");
+    WIFI_CONFIGURED = false;
+    drawStopped("No WiFi, try");
+    memcpy(expected, epd.panel, sizeof(expected));
+    memset(epd.panel, 0, sizeof(epd.panel));
+    watchy.showSyncList();
+    CHECK(memcmp(epd.panel, expected, sizeof(expected)) == 0);
+    CHECK_EQ(hostHttpRequests.size(), 1u);
+    hostHttpRequests.clear();
+}
+
+int main() {
+    remove("shopping.lst");
+    remove("shopping.chk");
+    checkScripts();
+    checkServer();
+    checkErrors();
+    return checkResult();
+}
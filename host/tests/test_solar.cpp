@@ -0,0 +1,141 @@
+// solveDayNight against a double-precision reference (the NOAA solar calculator's Meeus-based
+// equations, evaluated at the event itself) for every day of a leap and a non-leap year at
+// several latitudes, plus its run time.
+
+#include <Arduino.h>
+#include "solar.h"
+#include "lookups.h"
+#include "check.h"
+
+struct Place {
+    const char *name;
+    double latitude;
+    double longitude;
+    int32_t gmtOffset;
+};
+
+// Minutes either way, after rounding both to whole minutes
+#define TOLERANCE 1
+
+const Place places[] = {
+    {"Quito", -0.18, -78.47, -5 * 3600},
+    {"Cairo", 30.04, 31.24, 2 * 3600},
+    {"Sydney", -33.87, 151.21, 10 * 3600},
+    {"London", 51.51, -0.13, 0},
+    {"Oslo", 59.91, 10.75, 1 * 3600},
+    {"Tromso", 69.65, 18.96, 1 * 3600},
+};
+
+double radians(double degrees) {
+    return degrees * M_PI / 180;
+}
+
+double degrees(double radians) {
+    return radians * 180 / M_PI;
+}
+
+double julianDay(int year, int month, int day) {
+    if (month <= 2) {
+        year -= 1;
+        month += 12;
+    }
+    int a = year / 100;
+    int b = 2 - a + a / 4;
+    return floor(365.25 * (year + 4716)) + floor(30.6001 * (month + 1)) + day + b - 1524.5;
+}
+
+// Declination (radians) and equation of time (minutes) at a Julian day
+void sunPosition(double jd, double *declination, double *equationOfTime) {
+    double t = (jd - 2451545.0) / 36525.0;
+    double l0 = fmod(280.46646 + t * (36000.76983 + t * 0.0003032), 360);
+    double m = 357.52911 + t * (35999.05029 - 0.0001537 * t);
+    double e = 0.016708634 - t * (0.000042037 + 0.0000001267 * t);
+    double c = sin(radians(m)) * (1.914602 - t * (0.004817 + 0.000014 * t))
+               + sin(radians(2 * m)) * (0.019993 - 0.000101 * t) + sin(radians(3 * m)) * 0.000289;
+    double omega = 125.04 - 1934.136 * t;
+    double lambda = l0 + c - 0.00569 - 0.00478 * sin(radians(omega));
+    double epsilon0 = 23 + (26 + (21.448 - t * (46.815 + t * (0.00059 - t * 0.001813))) / 60) / 60;
+    double epsilon = epsilon0 + 0.00256 * cos(radians(omega));
+    *declination = asin(sin(radians(epsilon)) * sin(radians(lambda)));
+    double y = pow(tan(radians(epsilon) / 2), 2);
+    *equationOfTime = 4 * degrees(y * sin(2 * radians(l0)) - 2 * e * sin(radians(m))
+                                  + 4 * e * y * sin(radians(m)) * cos(2 * radians(l0))
+                                  - 0.5 * y * y * sin(4 * radians(l0)) - 1.25 * e * e * sin(2 * radians(m)));
+}
+
+double referenceCosHourAngle(double jd, const Place &place) {
+    double declination, equationOfTime;
+    sunPosition(jd, &declination, &equationOfTime);
+    double latitude = radians(place.latitude);
+    return cos(radians(90.833)) / (cos(latitude) * cos(declination)) - tan(latitude) * tan(declination);
+}
+
+// Sunrise (sign -1) or sunset (+1) in local minutes, refined at the event's own time;
+// NAN if the sun doesn't cross the horizon that day
+double referenceEvent(int year, int month, int day, const Place &place, int sign) {
+    double jd = julianDay(year, month, day);
+    double minutes = 720; // UTC
+    for (int i = 0; i < 3; i++) {
+        double declination, equationOfTime;
+        sunPosition(jd + minutes / 1440, &declination, &equationOfTime);
+        double cosHourAngle = referenceCosHourAngle(jd + minutes / 1440, place);
+        if (fabs(cosHourAngle) > 1) {
+            return NAN;
+        }
+        double hourAngle = degrees(acos(cosHourAngle));
+        minutes = 720 - 4 * (place.longitude - sign * hourAngle) - equationOfTime;
+    }
+    return minutes + place.gmtOffset / 60.0;
+}
+
+int main() {
+    const uint8_t monthDays[12] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    for (int year : {2023, 2024}) {
+        bool leapYear = year == 2024;
+        for (const Place &place : places) {
+            int worst = 0;
+            for (uint8_t month = 1; month <= 12; month++) {
+                for (uint8_t day = 1; day <= monthDays[month - 1]; day++) {
+                    if (month == 2 && day == 29 && !leapYear) {
+                        continue;
+                    }
+                    uint16_t row = monthStartDay[month] + day - 1;
+                    DayNight solved = solveDayNight(row, year, place.latitude, place.longitude, place.gmtOffset);
+                    double sunrise = referenceEvent(year, month, day, place, -1);
+                    double sunset = referenceEvent(year, month, day, place, 1);
+                    if (isnan(sunrise) || isnan(sunset)) {
+                        // The sun doesn't cross the horizon: up all day in summer (the first and
+                        // last days of midnight sun still have one crossing), down all day in winter
+                        if (month >= 4 && month <= 9) {
+                            CHECK(isnan(sunrise) ? solved.sunrise == 0 : abs(lround(sunrise) - solved.sunrise) <= TOLERANCE);
+                            // The evening before midnight sun starts, the sun can skim the horizon
+                            // for half an hour; the solver may still call that a sunset
+                            double jd = julianDay(year, month, day) + (solved.sunset - place.gmtOffset / 60.0) / 1440;
+                            CHECK(!isnan(sunset) ? abs(lround(sunset) - solved.sunset) <= TOLERANCE
+                                                 : solved.sunset == 1440 || referenceCosHourAngle(jd, place) > -1.01);
+                        } else {
+                            CHECK(solved.sunrise == solved.sunset);
+                        }
+                        continue;
+                    }
+                    int sunriseError = abs((int)lround(sunrise) - solved.sunrise);
+                    int sunsetError = abs((int)lround(sunset) - solved.sunset);
+                    worst = max(worst, max(sunriseError, sunsetError));
+                    if (sunriseError > TOLERANCE || sunsetError > TOLERANCE) {
+                        fprintf(stderr, "%s %d-%02d-%02d: sunrise %u vs %.1f, sunset %u vs %.1f\n", place.name,
+                                year, month, day, solved.sunrise, sunrise, solved.sunset, sunset);
+                        checkFailures++;
+                    }
+                }
+            }
+            printf("%d %-6s worst %d min\n", year, place.name, worst);
+        }
+    }
+
+    volatile int32_t sink = 0;
+    double micros = benchMicros(DAY_NIGHT_DAYS, [&](int day) {
+        sink += solveDayNight(day, 2024, 51.51f, -0.13f, 0).centre;
+    });
+    printf("solveDayNight %.3f us (host)\n", micros);
+    return checkResult();
+}
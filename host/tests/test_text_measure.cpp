@@ -0,0 +1,77 @@
+// measureText must give the box getTextBounds gives (with wrapping off) for every string the
+// sketch measures, and for arbitrary printable ones, in every bundled font.
+
+#include "WatchyChronometer.h"
+#include "text_measure.h"
+#include "MadeSunflower39pt7b.h"
+#include "DSEG7_Classic_Bold_25.h"
+#include "check.h"
+#include <string>
+#include <vector>
+
+GFXcanvas1 canvas(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+
+Rect adafruitBounds(const GFXfont *font, const char *str) {
+    int16_t x1, y1;
+    uint16_t w, h;
+    canvas.setFont(font);
+    canvas.setTextWrap(false);
+    canvas.getTextBounds(str, 0, 0, &x1, &y1, &w, &h);
+    if (w == 0 || h == 0) {
+        return Rect{0, 0, 0, 0};
+    }
+    return Rect{x1, y1, (int16_t)w, (int16_t)h};
+}
+
+int main() {
+    struct NamedFont {
+        const char *name;
+        const GFXfont *font;
+    };
+    const NamedFont fonts[] = {
+        {"FreeSansBold9pt7b", &FreeSansBold9pt7b},
+        {"FreeMonoBold9pt7b", &FreeMonoBold9pt7b},
+        {"MADE_Sunflower_PERSONAL_USE39pt7b", &MADE_Sunflower_PERSONAL_USE39pt7b},
+        {"DSEG7_Classic_Bold_25", &DSEG7_Classic_Bold_25},
+    };
+    std::vector<std::string> strings = {"", " ", "  ", "12:34", " Sat", "Sat ", "Jun 21", "Show Checked",
+                                        "14 left", "item\x7f", "\x01\x02", "a b  c"};
+    for (uint8_t wday = 1; wday <= 7; wday++) {
+        strings.push_back(dayStr(wday));
+    }
+    for (uint8_t month = 1; month <= 12; month++) {
+        strings.push_back(std::string(monthShortStr(month)) + " " + std::to_string(month * 2));
+    }
+    srand(3);
+    for (int i = 0; i < 2000; i++) {
+        std::string s;
+        for (int n = rand() % 12; n > 0; n--) {
+            s += (char)(' ' + rand() % 95);
+        }
+        strings.push_back(s);
+    }
+
+    for (const NamedFont &font : fonts) {
+        int wrong = 0;
+        for (const std::string &s : strings) {
+            Rect expected = adafruitBounds(font.font, s.c_str());
+            Rect measured = measureText(font.font, s.c_str());
+            if (memcmp(&expected, &measured, sizeof(Rect)) != 0) {
+                if (wrong++ < 3) {
+                    fprintf(stderr, "%s \"%s\": %d,%d %dx%d instead of %d,%d %dx%d\n", font.name, s.c_str(),
+                            measured.x, measured.y, measured.w, measured.h, expected.x, expected.y,
+                            expected.w, expected.h);
+                }
+            }
+        }
+        CHECK_EQ(wrong, 0);
+        double adafruit = benchMicros(200000, [&](int i) {
+            adafruitBounds(font.font, strings[i % strings.size()].c_str());
+        });
+        double table = benchMicros(200000, [&](int i) {
+            measureText(font.font, strings[i % strings.size()].c_str());
+        });
+        printf("%s: getTextBounds %.3f us, measureText %.3f us\n", font.name, adafruit, table);
+    }
+    return checkResult();
+}
@@ -0,0 +1,78 @@
+// drawTime blits the digits from time_glyphs.h. For every minute, in both colours, it must set
+// the same pixels as printing the 39pt font centred by getTextBounds, and mark the same
+// rectangle dirty.
+
+#include "WatchyChronometer.h"
+#include "MadeSunflower39pt7b.h"
+#include "check.h"
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+FrameBuffer &frame = WatchyChron::frame;
+
+extern uint16_t foregroundColor;
+extern uint16_t backgroundColor;
+extern Rect currMovingRect;
+
+GFXcanvas1 reference(DISPLAY_WIDTH, DISPLAY_HEIGHT);
+Rect referenceBounds;
+
+// The time as drawn through the font, with drawCenteredString's centring
+void drawReference(const char *timeStr) {
+    const int16_t x = DISPLAY_WIDTH / 2;
+    const int16_t y = DISPLAY_HEIGHT / 2 + 25;
+    int16_t x1, y1;
+    uint16_t w, h;
+    reference.fillScreen(backgroundColor);
+    reference.setFont(&MADE_Sunflower_PERSONAL_USE39pt7b);
+    reference.setTextColor(foregroundColor);
+    reference.setTextWrap(false);
+    reference.getTextBounds(timeStr, x, y, &x1, &y1, &w, &h);
+    reference.setCursor(x - w / 2, y);
+    reference.print(timeStr);
+    referenceBounds = Rect{(int16_t)(x1 - w / 2), y1, (int16_t)w, (int16_t)h};
+}
+
+void drawCached() {
+    frame.fillScreen(backgroundColor);
+    dirtyBeginFrame(0);
+    watchy.drawTime();
+}
+
+int main() {
+    const uint16_t colours[2][2] = {{GxEPD_BLACK, GxEPD_WHITE}, {GxEPD_WHITE, GxEPD_BLACK}};
+    int wrongPixels = 0;
+    int wrongBounds = 0;
+    for (const uint16_t *colour : colours) {
+        foregroundColor = colour[0];
+        backgroundColor = colour[1];
+        for (uint8_t hour = 0; hour < 24; hour++) {
+            for (uint8_t minute = 0; minute < 60; minute++) {
+                char timeStr[6];
+                snprintf(timeStr, sizeof(timeStr), "%d:%02d", hour, minute);
+                watchy.currentTime.Hour = hour;
+                watchy.currentTime.Minute = minute;
+                drawReference(timeStr);
+                drawCached();
+                wrongPixels += memcmp(frame.getBuffer(), reference.getBuffer(), frame.bufferSize()) != 0;
+                wrongBounds += memcmp(&currMovingRect, &referenceBounds, sizeof(Rect)) != 0;
+            }
+        }
+    }
+    CHECK_EQ(wrongPixels, 0);
+    CHECK_EQ(wrongBounds, 0);
+
+    // Per-minute cost, clearing the frame included in both
+    double font = benchMicros(24 * 60, [](int i) {
+        char timeStr[6];
+        snprintf(timeStr, sizeof(timeStr), "%d:%02d", i / 60, i % 60);
+        drawReference(timeStr);
+    });
+    double cached = benchMicros(24 * 60, [](int i) {
+        watchy.currentTime.Hour = i / 60;
+        watchy.currentTime.Minute = i % 60;
+        drawCached();
+    });
+    printf("time: %.2f us through the font, %.2f us from the glyph cache\n", font, cached);
+    return checkResult();
+}
@@ -0,0 +1,94 @@
+// showWatchFace pushes the frame straight to the panel controller: the panel must end up
+// showing exactly the rendered frame, with partial refreshes sending only the dirty window.
+
+#include "WatchyChronometer.h"
+#include "check.h"
+#include <host_hw.h>
+
+watchySettings settings = {};
+WatchyChron watchy(settings);
+WatchyDisplay &epd = Watchy::display.epd2;
+
+void setClock(uint8_t hour, uint8_t minute) {
+    tmElements_t tm = {};
+    tm.Year = CalendarYrToTm(2024);
+    tm.Month = 6;
+    tm.Day = 21;
+    tm.Hour = hour;
+    tm.Minute = minute;
+    hostRtcTime = makeTime(tm);
+    Watchy::RTC.read(watchy.currentTime);
+}
+
+bool panelShowsFrame() {
+    return memcmp(epd.panel, WatchyChron::frame.getBuffer(), sizeof(epd.panel)) == 0;
+}
+
+int main() {
+    const uint32_t fullBytes = DISPLAY_WIDTH / 8 * DISPLAY_HEIGHT;
+    guiState = MAIN_MENU_STATE;
+    setClock(9, 0);
+    epd.resetCounters();
+    watchy.showWatchFace(false);
+    CHECK(panelShowsFrame());
+    CHECK_EQ(guiState, WATCHFACE_STATE);
+    CHECK_EQ(epd.fullRefreshes, 1);
+    CHECK_EQ(epd.bytesWritten, 2 * fullBytes);
+
+    // A minute tick moves only the sun
+    uint32_t partialBytes = 0;
+    for (uint8_t minute = 1; minute <= 30; minute++) {
+        setClock(9, minute);
+        epd.resetCounters();
+        watchy.showWatchFace(true);
+        CHECK(panelShowsFrame());
+        CHECK_EQ(epd.partialRefreshes, 1);
+        CHECK(epd.bytesWritten < fullBytes / 2);
+        partialBytes += epd.bytesWritten;
+    }
+    printf("minute tick: %u bytes to the panel on average, %u for a full push\n", partialBytes / 30,
+           2 * fullBytes);
+
+    // Toggling the time display changes the layout, so the whole face goes
+    showTime = true;
+    epd.resetCounters();
+    watchy.showWatchFace(true);
+    CHECK(panelShowsFrame());
+    CHECK_EQ(epd.bytesWritten, 2 * fullBytes);
+    showTime = false;
+    watchy.showWatchFace(true);
+
+    // Minute alarm wakeups come through WatchyChron::init, not the library's full-screen push
+    hostWakeupCause = ESP_SLEEP_WAKEUP_EXT0;
+    uint16_t libraryFaces = hostLibraryFaces;
+    uint16_t sleeps = hostDeepSleeps;
+    setClock(10, 0);
+    epd.resetCounters();
+    watchy.init();
+    CHECK(panelShowsFrame());
+    CHECK_EQ(epd.fullRefreshes, 0);
+    CHECK_EQ(epd.partialRefreshes, 1);
+    CHECK(epd.bytesWritten < fullBytes / 2);
+    CHECK_EQ(hostLibraryFaces, libraryFaces);
+    CHECK_EQ(hostDeepSleeps, sleeps + 1);
+
+    // A menu left open gets one tick's grace, then the face comes back with a full refresh
+    guiState = MAIN_MENU_STATE;
+    alreadyInMenu = false;
+    watchy.init();
+    CHECK_EQ(guiState, MAIN_MENU_STATE);
+    CHECK(alreadyInMenu);
+    setClock(10, 2);
+    epd.resetCounters();
+    watchy.init();
+    CHECK_EQ(guiState, WATCHFACE_STATE);
+    CHECK(panelShowsFrame());
+    CHECK_EQ(epd.fullRefreshes, 1);
+    CHECK_EQ(hostLibraryFaces, libraryFaces);
+
+    // First boot is still the library's
+    hostWakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+    watchy.init();
+    CHECK_EQ(hostLibraryFaces, libraryFaces + 1);
+    return checkResult();
+}
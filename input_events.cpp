@@ -0,0 +1,162 @@
+#include "input_events.h"
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+
+const uint8_t *buttonPins;
+uint8_t displayBusyPin;
+volatile uint8_t inputQueue[INPUT_QUEUE_LENGTH];
+volatile uint8_t inputHead = 0;
+volatile uint8_t inputTail = 0;
+Debouncer debouncers[BUTTON_COUNT];
+uint8_t lastPressed = BUTTON_NONE;
+AutoRepeat autoRepeat;
+
+void IRAM_ATTR onButtonEdge(void *arg) {
+    uint8_t button = (uintptr_t)arg;
+    if (!debounceChange(debouncers[button], digitalRead(buttonPins[button]) == 1, millis(), INPUT_DEBOUNCE_MS)) {
+        return;
+    }
+    uint8_t next = (inputHead + 1) % INPUT_QUEUE_LENGTH;
+    if (next != inputTail) { // drop presses if the queue is full
+        inputQueue[inputHead] = button;
+        inputHead = next;
+    }
+}
+
+bool inputPop(uint8_t &button) {
+    if (inputTail == inputHead) {
+        return false;
+    }
+    button = inputQueue[inputTail];
+    inputTail = (inputTail + 1) % INPUT_QUEUE_LENGTH;
+    return true;
+}
+
+void attachButtons() {
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        attachInterruptArg(buttonPins[i], onButtonEdge, (void *)(uintptr_t)i, CHANGE);
+    }
+}
+
+void inputBegin(const uint8_t pins[BUTTON_COUNT], uint8_t busyPin) {
+    buttonPins = pins;
+    displayBusyPin = busyPin;
+    inputFlush();
+    // ext1 is what woke us from deep sleep; a held button would keep waking light sleep.
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_EXT1);
+    // The minute alarm is picked up when we go back to deep sleep
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_EXT0);
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        pinMode(pins[i], INPUT);
+        // The button that woke us is down already and counts as pressed
+        debouncers[i].stable = digitalRead(pins[i]) == 1;
+        debouncers[i].lastChangeMs = millis();
+    }
+    attachButtons();
+}
+
+void inputEnd() {
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        detachInterrupt(buttonPins[i]);
+        gpio_wakeup_disable((gpio_num_t)buttonPins[i]);
+    }
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+}
+
+void inputFlush() {
+    inputTail = inputHead;
+    lastPressed = BUTTON_NONE;
+    repeatStop(autoRepeat);
+}
+
+void syncButtons() {
+    // Catch level changes whose edges were missed while the interrupts were off
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        onButtonEdge((void *)(uintptr_t)i);
+    }
+}
+
+void lightSleepFor(uint32_t ms) {
+    // Wake when any button changes from its debounced level, or when the time is up. Light
+    // sleep wakeup needs level triggers, so the edge interrupts are off meanwhile.
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        detachInterrupt(buttonPins[i]);
+    }
+    syncButtons();
+    // Every refresh arms a wakeup on BUSY low and never disarms it; BUSY is low whenever the
+    // panel is idle, so it would end each light sleep at once
+    gpio_wakeup_disable((gpio_num_t)displayBusyPin);
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        if ((digitalRead(buttonPins[i]) == 1) != debouncers[i].stable) {
+            // Changed too soon to count yet: look again once the bounce is over
+            ms = min(ms, (uint32_t)INPUT_DEBOUNCE_MS - (millis() - debouncers[i].lastChangeMs));
+        } else {
+            // A held button wakes us when it is let go, so auto-repeat stops and the next press is seen
+            gpio_wakeup_enable((gpio_num_t)buttonPins[i], debouncers[i].stable ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
+        }
+    }
+    if (inputTail == inputHead) {
+        esp_sleep_enable_gpio_wakeup();
+        esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+        esp_light_sleep_start();
+    }
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        gpio_wakeup_disable((gpio_num_t)buttonPins[i]);
+    }
+    syncButtons();
+    attachButtons();
+}
+
+void startRepeat(uint8_t button, uint8_t repeatMask, const RepeatConfig &repeat) {
+    lastPressed = button;
+    if (repeatMask & (1 << button)) {
+        repeatStart(autoRepeat, millis(), repeat);
+    } else {
+        repeatStop(autoRepeat);
+    }
+}
+
+void inputPressed(uint8_t button, uint8_t repeatMask, const RepeatConfig &repeat) {
+    if (button < BUTTON_COUNT && debouncers[button].stable) {
+        startRepeat(button, repeatMask, repeat);
+    }
+}
+
+bool inputWait(InputEvent &event, uint32_t timeoutMs, uint8_t repeatMask, const RepeatConfig &repeat) {
+    uint32_t start = millis();
+    while (true) {
+        if (inputPop(event.button)) {
+            event.repeat = REPEAT_NONE;
+            startRepeat(event.button, repeatMask, repeat);
+            return true;
+        }
+        uint32_t now = millis();
+        if (autoRepeat.active && !debouncers[lastPressed].stable) {
+            repeatStop(autoRepeat); // released
+        }
+        event.repeat = repeatPoll(autoRepeat, now, repeat);
+        if (event.repeat != REPEAT_NONE) {
+            event.button = lastPressed;
+            return true;
+        }
+        if (now - start >= timeoutMs) {
+            return false;
+        }
+        lightSleepFor(min(timeoutMs - (now - start), repeatWaitMs(autoRepeat, now)));
+    }
+}
+
+bool inputPoll(InputEvent &event) {
+    event.repeat = REPEAT_NONE;
+    return inputPop(event.button);
+}
+
+uint8_t buttonFromWakeup(uint64_t wakeupBits, const uint8_t pins[BUTTON_COUNT]) {
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        if (wakeupBits & ((uint64_t)1 << pins[i])) {
+            return i;
+        }
+    }
+    return BUTTON_NONE;
+}
@@ -0,0 +1,41 @@
+#ifndef INPUT_EVENTS_H
+#define INPUT_EVENTS_H
+
+#include <Arduino.h>
+#include "button_repeat.h"
+
+enum Button : uint8_t {
+    BUTTON_MENU,
+    BUTTON_BACK,
+    BUTTON_UP,
+    BUTTON_DOWN,
+    BUTTON_COUNT,
+    BUTTON_NONE = 0xFF
+};
+
+// Presses queued while the CPU is busy (e.g. waiting on a panel refresh)
+#define INPUT_QUEUE_LENGTH 8
+// Edges closer together than this on one pin are contact bounce
+#define INPUT_DEBOUNCE_MS 30
+
+struct InputEvent {
+    uint8_t button;
+    uint8_t repeat; // REPEAT_NONE for a real press, otherwise what the hold asks for
+};
+
+// Button presses after a wake from deep sleep. Presses are caught by GPIO interrupts and
+// queued; while waiting for the next one the CPU is in light sleep instead of polling.
+// busyPin is the display's BUSY line, whose wakeup the display driver leaves armed.
+void inputBegin(const uint8_t pins[BUTTON_COUNT], uint8_t busyPin);
+void inputEnd();
+void inputFlush();
+// Next press, or false after timeoutMs with nothing pressed.
+// Buttons in repeatMask (bits of Button) keep sending events while held.
+bool inputWait(InputEvent &event, uint32_t timeoutMs, uint8_t repeatMask, const RepeatConfig &repeat);
+// A press inputWait didn't return, i.e. the button that woke us: holding it repeats as well
+void inputPressed(uint8_t button, uint8_t repeatMask, const RepeatConfig &repeat);
+// Next queued press without waiting, for screens that have to keep the CPU busy (e.g. Wi-Fi)
+bool inputPoll(InputEvent &event);
+uint8_t buttonFromWakeup(uint64_t wakeupBits, const uint8_t pins[BUTTON_COUNT]);
+
+#endif
@@ -0,0 +1,72 @@
+#include "list_view.h"
+
+// Which page and selection the panel is showing. Survives deep sleep, so a button press
+// after waking only has to push the two rows that changed.
+RTC_DATA_ATTR uint8_t shownListId = 0xFF;
+RTC_DATA_ATTR uint16_t shownListTop;
+RTC_DATA_ATTR uint16_t shownListSelected;
+RTC_DATA_ATTR uint32_t shownFooterHash;
+// The display's frame buffer does not survive deep sleep
+bool listBuffered = false;
+bool listChanged = false;
+
+uint32_t footerHash(const char *footer) {
+    // FNV-1a; 0 means no footer
+    if (!footer) {
+        return 0;
+    }
+    uint32_t hash = 2166136261u;
+    while (*footer) {
+        hash = (hash ^ (uint8_t)*footer++) * 16777619u;
+    }
+    return hash | 1;
+}
+
+ListViewPlan listViewPlan(const ListView &list, uint16_t selected, bool partialRefresh) {
+    ListViewPlan plan;
+    plan.top = (selected / list.rows) * list.rows;
+    plan.fullPage = !partialRefresh || shownListId != list.id || shownListTop != plan.top;
+    plan.pushPage = !plan.fullPage && listChanged;
+    plan.drawPage = plan.fullPage || plan.pushPage || !listBuffered;
+    uint32_t hash = footerHash(list.footer);
+    plan.footer = hash != shownFooterHash || plan.drawPage;
+    plan.rows[0] = -1;
+    plan.rows[1] = -1;
+    if (!plan.fullPage && !plan.pushPage) {
+        plan.rows[0] = shownListSelected - plan.top;
+        if (selected != shownListSelected) {
+            plan.rows[1] = selected - plan.top;
+        }
+    }
+    shownListId = list.id;
+    shownListTop = plan.top;
+    shownListSelected = selected;
+    shownFooterHash = hash;
+    listBuffered = true;
+    listChanged = false;
+    return plan;
+}
+
+void listViewChanged() {
+    listChanged = true;
+}
+
+void listViewInvalidate() {
+    shownListId = 0xFF;
+    listBuffered = false;
+}
+
+int16_t listRowBaseline(const ListView &list, int16_t row) {
+    return list.rowHeight * (row + 1);
+}
+
+Rect listRowBand(const ListView &list, int16_t row, int16_t width) {
+    // Highlight box runs from just below the previous row's descenders to below this row's
+    return Rect{0, (int16_t)(listRowBaseline(list, row) - list.rowHeight + 6), width, (int16_t)list.rowHeight};
+}
+
+Rect listFooterBand(const ListView &list, int16_t width, int16_t height) {
+    Rect last = listRowBand(list, list.rows - 1, width);
+    int16_t top = last.y + last.h;
+    return Rect{0, top, width, (int16_t)(height - top)};
+}
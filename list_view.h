@@ -0,0 +1,45 @@
+#ifndef LIST_VIEW_H
+#define LIST_VIEW_H
+
+#include <Arduino.h>
+#include "dirty_region.h"
+
+#ifndef RTC_DATA_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+typedef const char *(*ListItemText)(uint16_t index);
+typedef bool (*ListItemChecked)(uint16_t index);
+
+// A scrolling list of text rows (main menu, shopping list, ...) shown a page at a time.
+// Items come from callbacks, so only the rows on screen are ever looked at.
+struct ListView {
+    uint8_t id;                  // distinguishes lists sharing the panel
+    ListItemText itemText;
+    ListItemChecked itemChecked; // nullptr if the list has no check marks
+    uint16_t length;
+    uint8_t rows;                // rows per page
+    uint8_t rowHeight;           // pixels between baselines
+    const char *footer;          // shown right-aligned under the rows, nullptr for none
+};
+
+// What a list change needs redrawn. Rows are relative to the top of the page.
+struct ListViewPlan {
+    bool fullPage;     // page changed or panel shows something else: draw and push everything
+    bool drawPage;     // frame buffer was lost (deep sleep): draw every row, push only the bands
+    bool pushPage;     // items changed under the page: push every row, but as a partial refresh
+    bool footer;       // footer text changed
+    uint16_t top;      // first item on the page
+    int16_t rows[2];   // row bands to repaint, -1 if unused
+};
+
+ListViewPlan listViewPlan(const ListView &list, uint16_t selected, bool partialRefresh);
+// Items were added, removed or reordered; the next plan redraws the whole page
+void listViewChanged();
+// Something else drew on the display (a library screen); the next plan draws and pushes everything
+void listViewInvalidate();
+Rect listRowBand(const ListView &list, int16_t row, int16_t width);
+Rect listFooterBand(const ListView &list, int16_t width, int16_t height);
+int16_t listRowBaseline(const ListView &list, int16_t row);
+
+#endif
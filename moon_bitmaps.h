@@ -454,7 +454,8 @@ const unsigned char* bmp_moonWax2qrt_array[30] = {
 	bmp_moonWax2qrt_25_172ccw,
 	bmp_moonWax2qrt_26_180ccw,
 	bmp_moonWax2qrt_27_187ccw,
-	bmp_moonWax2qrt_28_195ccw
+	bmp_moonWax2qrt_28_195ccw,
+	bmp_moonWax2qrt_29_202ccw
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,1458 @@
+#ifndef ORBIT_LOOKUP_H
+#define ORBIT_LOOKUP_H
+
+// Generated by tools/orbit_table.py, do not edit.
+// Top-left of the sun (65px) and moon (33px) icons for each minute of the day,
+// each stored plus the ORBIT_*_OFFSET below so it fits a uint8
+
+#define ORBIT_SUN_X 0
+#define ORBIT_SUN_Y 1
+#define ORBIT_MOON_X 2
+#define ORBIT_MOON_Y 3
+#define ORBIT_SUN_OFFSET 32
+#define ORBIT_MOON_OFFSET 16
+
+const uint8_t orbitLookup[1440][4] PROGMEM = {
+/*    0 */   {100,198,100,198},
+/*    1 */   {100,197,100,197},
+/*    2 */   {100,197,100,197},
+/*    3 */   {101,197,101,197},
+/*    4 */   {101,197,101,197},
+/*    5 */   {102,197,102,197},
+/*    6 */   {102,197,102,197},
+/*    7 */   {102,197,102,197},
+/*    8 */   {103,197,103,197},
+/*    9 */   {103,197,103,197},
+/*   10 */   {104,197,104,197},
+/*   11 */   {104,197,104,197},
+/*   12 */   {105,197,105,197},
+/*   13 */   {105,197,105,197},
+/*   14 */   {105,197,105,197},
+/*   15 */   {106,197,106,197},
+/*   16 */   {106,197,106,197},
+/*   17 */   {107,197,107,197},
+/*   18 */   {107,197,107,197},
+/*   19 */   {108,197,108,197},
+/*   20 */   {108,197,108,197},
+/*   21 */   {108,197,108,197},
+/*   22 */   {109,197,109,197},
+/*   23 */   {109,197,109,197},
+/*   24 */   {110,197,110,197},
+/*   25 */   {110,197,110,197},
+/*   26 */   {111,197,111,197},
+/*   27 */   {111,197,111,197},
+/*   28 */   {111,197,111,197},
+/*   29 */   {112,197,112,197},
+/*   30 */   {112,197,112,197},
+/*   31 */   {113,197,113,197},
+/*   32 */   {113,197,113,197},
+/*   33 */   {114,196,114,196},
+/*   34 */   {114,196,114,196},
+/*   35 */   {114,196,114,196},
+/*   36 */   {115,196,115,196},
+/*   37 */   {115,196,115,196},
+/*   38 */   {116,196,116,196},
+/*   39 */   {116,196,116,196},
+/*   40 */   {117,196,117,196},
+/*   41 */   {117,196,117,196},
+/*   42 */   {117,196,117,196},
+/*   43 */   {118,196,118,196},
+/*   44 */   {118,196,118,196},
+/*   45 */   {119,196,119,196},
+/*   46 */   {119,196,119,196},
+/*   47 */   {119,195,119,195},
+/*   48 */   {120,195,120,195},
+/*   49 */   {120,195,120,195},
+/*   50 */   {121,195,121,195},
+/*   51 */   {121,195,121,195},
+/*   52 */   {122,195,122,195},
+/*   53 */   {122,195,122,195},
+/*   54 */   {122,195,122,195},
+/*   55 */   {123,195,123,195},
+/*   56 */   {123,195,123,195},
+/*   57 */   {124,194,124,194},
+/*   58 */   {124,194,124,194},
+/*   59 */   {124,194,124,194},
+/*   60 */   {125,194,125,194},
+/*   61 */   {125,194,125,194},
+/*   62 */   {126,194,126,194},
+/*   63 */   {126,194,126,194},
+/*   64 */   {127,194,127,194},
+/*   65 */   {127,194,127,194},
+/*   66 */   {127,193,127,193},
+/*   67 */   {128,193,128,193},
+/*   68 */   {128,193,128,193},
+/*   69 */   {129,193,129,193},
+/*   70 */   {129,193,129,193},
+/*   71 */   {129,193,129,193},
+/*   72 */   {130,193,130,193},
+/*   73 */   {130,193,130,193},
+/*   74 */   {131,192,131,192},
+/*   75 */   {131,192,131,192},
+/*   76 */   {131,192,131,192},
+/*   77 */   {132,192,132,192},
+/*   78 */   {132,192,132,192},
+/*   79 */   {133,192,133,192},
+/*   80 */   {133,192,133,192},
+/*   81 */   {133,191,133,191},
+/*   82 */   {134,191,134,191},
+/*   83 */   {134,191,134,191},
+/*   84 */   {135,191,135,191},
+/*   85 */   {135,191,135,191},
+/*   86 */   {135,191,135,191},
+/*   87 */   {136,191,136,191},
+/*   88 */   {136,190,136,190},
+/*   89 */   {137,190,137,190},
+/*   90 */   {137,190,137,190},
+/*   91 */   {137,190,137,190},
+/*   92 */   {138,190,138,190},
+/*   93 */   {138,190,138,190},
+/*   94 */   {139,189,139,189},
+/*   95 */   {139,189,139,189},
+/*   96 */   {139,189,139,189},
+/*   97 */   {140,189,140,189},
+/*   98 */   {140,189,140,189},
+/*   99 */   {141,188,141,188},
+/*  100 */   {141,188,141,188},
+/*  101 */   {141,188,141,188},
+/*  102 */   {142,188,142,188},
+/*  103 */   {142,188,142,188},
+/*  104 */   {142,188,142,188},
+/*  105 */   {143,187,143,187},
+/*  106 */   {143,187,143,187},
+/*  107 */   {144,187,144,187},
+/*  108 */   {144,187,144,187},
+/*  109 */   {144,187,144,187},
+/*  110 */   {145,186,145,186},
+/*  111 */   {145,186,145,186},
+/*  112 */   {146,186,146,186},
+/*  113 */   {146,186,146,186},
+/*  114 */   {146,186,146,186},
+/*  115 */   {147,185,147,185},
+/*  116 */   {147,185,147,185},
+/*  117 */   {147,185,147,185},
+/*  118 */   {148,185,148,185},
+/*  119 */   {148,185,148,185},
+/*  120 */   {149,184,149,184},
+/*  121 */   {149,184,149,184},
+/*  122 */   {149,184,149,184},
+/*  123 */   {150,184,150,184},
+/*  124 */   {150,184,150,184},
+/*  125 */   {150,183,150,183},
+/*  126 */   {151,183,151,183},
+/*  127 */   {151,183,151,183},
+/*  128 */   {151,183,151,183},
+/*  129 */   {152,182,152,182},
+/*  130 */   {152,182,152,182},
+/*  131 */   {153,182,153,182},
+/*  132 */   {153,182,153,182},
+/*  133 */   {153,181,153,181},
+/*  134 */   {154,181,154,181},
+/*  135 */   {154,181,154,181},
+/*  136 */   {154,181,154,181},
+/*  137 */   {155,181,155,181},
+/*  138 */   {155,180,155,180},
+/*  139 */   {155,180,155,180},
+/*  140 */   {156,180,156,180},
+/*  141 */   {156,180,156,180},
+/*  142 */   {156,179,156,179},
+/*  143 */   {157,179,157,179},
+/*  144 */   {157,179,157,179},
+/*  145 */   {157,179,157,179},
+/*  146 */   {158,178,158,178},
+/*  147 */   {158,178,158,178},
+/*  148 */   {158,178,158,178},
+/*  149 */   {159,178,159,178},
+/*  150 */   {159,177,159,177},
+/*  151 */   {159,177,159,177},
+/*  152 */   {160,177,160,177},
+/*  153 */   {160,176,160,176},
+/*  154 */   {161,176,161,176},
+/*  155 */   {161,176,161,176},
+/*  156 */   {161,176,161,176},
+/*  157 */   {162,175,162,175},
+/*  158 */   {162,175,162,175},
+/*  159 */   {162,175,162,175},
+/*  160 */   {162,175,162,175},
+/*  161 */   {163,174,163,174},
+/*  162 */   {163,174,163,174},
+/*  163 */   {163,174,163,174},
+/*  164 */   {164,173,164,173},
+/*  165 */   {164,173,164,173},
+/*  166 */   {164,173,164,173},
+/*  167 */   {165,173,165,173},
+/*  168 */   {165,172,165,172},
+/*  169 */   {165,172,165,172},
+/*  170 */   {166,172,166,172},
+/*  171 */   {166,171,166,171},
+/*  172 */   {166,171,166,171},
+/*  173 */   {167,171,167,171},
+/*  174 */   {167,171,167,171},
+/*  175 */   {167,170,167,170},
+/*  176 */   {168,170,168,170},
+/*  177 */   {168,170,168,170},
+/*  178 */   {168,169,168,169},
+/*  179 */   {168,169,168,169},
+/*  180 */   {169,169,169,169},
+/*  181 */   {169,168,169,168},
+/*  182 */   {169,168,169,168},
+/*  183 */   {170,168,170,168},
+/*  184 */   {170,168,170,168},
+/*  185 */   {170,167,170,167},
+/*  186 */   {171,167,171,167},
+/*  187 */   {171,167,171,167},
+/*  188 */   {171,166,171,166},
+/*  189 */   {171,166,171,166},
+/*  190 */   {172,166,172,166},
+/*  191 */   {172,165,172,165},
+/*  192 */   {172,165,172,165},
+/*  193 */   {173,165,173,165},
+/*  194 */   {173,164,173,164},
+/*  195 */   {173,164,173,164},
+/*  196 */   {173,164,173,164},
+/*  197 */   {174,163,174,163},
+/*  198 */   {174,163,174,163},
+/*  199 */   {174,163,174,163},
+/*  200 */   {175,162,175,162},
+/*  201 */   {175,162,175,162},
+/*  202 */   {175,162,175,162},
+/*  203 */   {175,162,175,162},
+/*  204 */   {176,161,176,161},
+/*  205 */   {176,161,176,161},
+/*  206 */   {176,161,176,161},
+/*  207 */   {176,160,176,160},
+/*  208 */   {177,160,177,160},
+/*  209 */   {177,159,177,159},
+/*  210 */   {177,159,177,159},
+/*  211 */   {178,159,178,159},
+/*  212 */   {178,158,178,158},
+/*  213 */   {178,158,178,158},
+/*  214 */   {178,158,178,158},
+/*  215 */   {179,157,179,157},
+/*  216 */   {179,157,179,157},
+/*  217 */   {179,157,179,157},
+/*  218 */   {179,156,179,156},
+/*  219 */   {180,156,180,156},
+/*  220 */   {180,156,180,156},
+/*  221 */   {180,155,180,155},
+/*  222 */   {180,155,180,155},
+/*  223 */   {181,155,181,155},
+/*  224 */   {181,154,181,154},
+/*  225 */   {181,154,181,154},
+/*  226 */   {181,154,181,154},
+/*  227 */   {181,153,181,153},
+/*  228 */   {182,153,182,153},
+/*  229 */   {182,153,182,153},
+/*  230 */   {182,152,182,152},
+/*  231 */   {182,152,182,152},
+/*  232 */   {183,151,183,151},
+/*  233 */   {183,151,183,151},
+/*  234 */   {183,151,183,151},
+/*  235 */   {183,150,183,150},
+/*  236 */   {184,150,184,150},
+/*  237 */   {184,150,184,150},
+/*  238 */   {184,149,184,149},
+/*  239 */   {184,149,184,149},
+/*  240 */   {184,149,184,149},
+/*  241 */   {185,148,185,148},
+/*  242 */   {185,148,185,148},
+/*  243 */   {185,147,185,147},
+/*  244 */   {185,147,185,147},
+/*  245 */   {185,147,185,147},
+/*  246 */   {186,146,186,146},
+/*  247 */   {186,146,186,146},
+/*  248 */   {186,146,186,146},
+/*  249 */   {186,145,186,145},
+/*  250 */   {186,145,186,145},
+/*  251 */   {187,144,187,144},
+/*  252 */   {187,144,187,144},
+/*  253 */   {187,144,187,144},
+/*  254 */   {187,143,187,143},
+/*  255 */   {187,143,187,143},
+/*  256 */   {188,142,188,142},
+/*  257 */   {188,142,188,142},
+/*  258 */   {188,142,188,142},
+/*  259 */   {188,141,188,141},
+/*  260 */   {188,141,188,141},
+/*  261 */   {188,141,188,141},
+/*  262 */   {189,140,189,140},
+/*  263 */   {189,140,189,140},
+/*  264 */   {189,139,189,139},
+/*  265 */   {189,139,189,139},
+/*  266 */   {189,139,189,139},
+/*  267 */   {190,138,190,138},
+/*  268 */   {190,138,190,138},
+/*  269 */   {190,137,190,137},
+/*  270 */   {190,137,190,137},
+/*  271 */   {190,137,190,137},
+/*  272 */   {190,136,190,136},
+/*  273 */   {191,136,191,136},
+/*  274 */   {191,135,191,135},
+/*  275 */   {191,135,191,135},
+/*  276 */   {191,135,191,135},
+/*  277 */   {191,134,191,134},
+/*  278 */   {191,134,191,134},
+/*  279 */   {191,133,191,133},
+/*  280 */   {192,133,192,133},
+/*  281 */   {192,133,192,133},
+/*  282 */   {192,132,192,132},
+/*  283 */   {192,132,192,132},
+/*  284 */   {192,131,192,131},
+/*  285 */   {192,131,192,131},
+/*  286 */   {192,131,192,131},
+/*  287 */   {193,130,193,130},
+/*  288 */   {193,130,193,130},
+/*  289 */   {193,129,193,129},
+/*  290 */   {193,129,193,129},
+/*  291 */   {193,129,193,129},
+/*  292 */   {193,128,193,128},
+/*  293 */   {193,128,193,128},
+/*  294 */   {193,127,193,127},
+/*  295 */   {194,127,194,127},
+/*  296 */   {194,127,194,127},
+/*  297 */   {194,126,194,126},
+/*  298 */   {194,126,194,126},
+/*  299 */   {194,125,194,125},
+/*  300 */   {194,125,194,125},
+/*  301 */   {194,124,194,124},
+/*  302 */   {194,124,194,124},
+/*  303 */   {194,124,194,124},
+/*  304 */   {195,123,195,123},
+/*  305 */   {195,123,195,123},
+/*  306 */   {195,122,195,122},
+/*  307 */   {195,122,195,122},
+/*  308 */   {195,122,195,122},
+/*  309 */   {195,121,195,121},
+/*  310 */   {195,121,195,121},
+/*  311 */   {195,120,195,120},
+/*  312 */   {195,120,195,120},
+/*  313 */   {195,119,195,119},
+/*  314 */   {196,119,196,119},
+/*  315 */   {196,119,196,119},
+/*  316 */   {196,118,196,118},
+/*  317 */   {196,118,196,118},
+/*  318 */   {196,117,196,117},
+/*  319 */   {196,117,196,117},
+/*  320 */   {196,117,196,117},
+/*  321 */   {196,116,196,116},
+/*  322 */   {196,116,196,116},
+/*  323 */   {196,115,196,115},
+/*  324 */   {196,115,196,115},
+/*  325 */   {196,114,196,114},
+/*  326 */   {196,114,196,114},
+/*  327 */   {196,114,196,114},
+/*  328 */   {197,113,197,113},
+/*  329 */   {197,113,197,113},
+/*  330 */   {197,112,197,112},
+/*  331 */   {197,112,197,112},
+/*  332 */   {197,111,197,111},
+/*  333 */   {197,111,197,111},
+/*  334 */   {197,111,197,111},
+/*  335 */   {197,110,197,110},
+/*  336 */   {197,110,197,110},
+/*  337 */   {197,109,197,109},
+/*  338 */   {197,109,197,109},
+/*  339 */   {197,108,197,108},
+/*  340 */   {197,108,197,108},
+/*  341 */   {197,108,197,108},
+/*  342 */   {197,107,197,107},
+/*  343 */   {197,107,197,107},
+/*  344 */   {197,106,197,106},
+/*  345 */   {197,106,197,106},
+/*  346 */   {197,105,197,105},
+/*  347 */   {197,105,197,105},
+/*  348 */   {197,105,197,105},
+/*  349 */   {197,104,197,104},
+/*  350 */   {197,104,197,104},
+/*  351 */   {197,103,197,103},
+/*  352 */   {197,103,197,103},
+/*  353 */   {197,102,197,102},
+/*  354 */   {197,102,197,102},
+/*  355 */   {197,102,197,102},
+/*  356 */   {197,101,197,101},
+/*  357 */   {197,101,197,101},
+/*  358 */   {197,100,197,100},
+/*  359 */   {197,100,197,100},
+/*  360 */   {198,100,198,100},
+/*  361 */   {197,99,197,99},
+/*  362 */   {197,99,197,99},
+/*  363 */   {197,98,197,98},
+/*  364 */   {197,98,197,98},
+/*  365 */   {197,97,197,97},
+/*  366 */   {197,97,197,97},
+/*  367 */   {197,97,197,97},
+/*  368 */   {197,96,197,96},
+/*  369 */   {197,96,197,96},
+/*  370 */   {197,95,197,95},
+/*  371 */   {197,95,197,95},
+/*  372 */   {197,94,197,94},
+/*  373 */   {197,94,197,94},
+/*  374 */   {197,94,197,94},
+/*  375 */   {197,93,197,93},
+/*  376 */   {197,93,197,93},
+/*  377 */   {197,92,197,92},
+/*  378 */   {197,92,197,92},
+/*  379 */   {197,91,197,91},
+/*  380 */   {197,91,197,91},
+/*  381 */   {197,91,197,91},
+/*  382 */   {197,90,197,90},
+/*  383 */   {197,90,197,90},
+/*  384 */   {197,89,197,89},
+/*  385 */   {197,89,197,89},
+/*  386 */   {197,88,197,88},
+/*  387 */   {197,88,197,88},
+/*  388 */   {197,88,197,88},
+/*  389 */   {197,87,197,87},
+/*  390 */   {197,87,197,87},
+/*  391 */   {197,86,197,86},
+/*  392 */   {197,86,197,86},
+/*  393 */   {196,85,196,85},
+/*  394 */   {196,85,196,85},
+/*  395 */   {196,85,196,85},
+/*  396 */   {196,84,196,84},
+/*  397 */   {196,84,196,84},
+/*  398 */   {196,83,196,83},
+/*  399 */   {196,83,196,83},
+/*  400 */   {196,82,196,82},
+/*  401 */   {196,82,196,82},
+/*  402 */   {196,82,196,82},
+/*  403 */   {196,81,196,81},
+/*  404 */   {196,81,196,81},
+/*  405 */   {196,80,196,80},
+/*  406 */   {196,80,196,80},
+/*  407 */   {195,80,195,80},
+/*  408 */   {195,79,195,79},
+/*  409 */   {195,79,195,79},
+/*  410 */   {195,78,195,78},
+/*  411 */   {195,78,195,78},
+/*  412 */   {195,77,195,77},
+/*  413 */   {195,77,195,77},
+/*  414 */   {195,77,195,77},
+/*  415 */   {195,76,195,76},
+/*  416 */   {195,76,195,76},
+/*  417 */   {194,75,194,75},
+/*  418 */   {194,75,194,75},
+/*  419 */   {194,75,194,75},
+/*  420 */   {194,74,194,74},
+/*  421 */   {194,74,194,74},
+/*  422 */   {194,73,194,73},
+/*  423 */   {194,73,194,73},
+/*  424 */   {194,72,194,72},
+/*  425 */   {194,72,194,72},
+/*  426 */   {193,72,193,72},
+/*  427 */   {193,71,193,71},
+/*  428 */   {193,71,193,71},
+/*  429 */   {193,70,193,70},
+/*  430 */   {193,70,193,70},
+/*  431 */   {193,70,193,70},
+/*  432 */   {193,69,193,69},
+/*  433 */   {193,69,193,69},
+/*  434 */   {192,68,192,68},
+/*  435 */   {192,68,192,68},
+/*  436 */   {192,68,192,68},
+/*  437 */   {192,67,192,67},
+/*  438 */   {192,67,192,67},
+/*  439 */   {192,66,192,66},
+/*  440 */   {192,66,192,66},
+/*  441 */   {191,66,191,66},
+/*  442 */   {191,65,191,65},
+/*  443 */   {191,65,191,65},
+/*  444 */   {191,64,191,64},
+/*  445 */   {191,64,191,64},
+/*  446 */   {191,64,191,64},
+/*  447 */   {191,63,191,63},
+/*  448 */   {190,63,190,63},
+/*  449 */   {190,62,190,62},
+/*  450 */   {190,62,190,62},
+/*  451 */   {190,62,190,62},
+/*  452 */   {190,61,190,61},
+/*  453 */   {190,61,190,61},
+/*  454 */   {189,60,189,60},
+/*  455 */   {189,60,189,60},
+/*  456 */   {189,60,189,60},
+/*  457 */   {189,59,189,59},
+/*  458 */   {189,59,189,59},
+/*  459 */   {188,58,188,58},
+/*  460 */   {188,58,188,58},
+/*  461 */   {188,58,188,58},
+/*  462 */   {188,57,188,57},
+/*  463 */   {188,57,188,57},
+/*  464 */   {188,57,188,57},
+/*  465 */   {187,56,187,56},
+/*  466 */   {187,56,187,56},
+/*  467 */   {187,55,187,55},
+/*  468 */   {187,55,187,55},
+/*  469 */   {187,55,187,55},
+/*  470 */   {186,54,186,54},
+/*  471 */   {186,54,186,54},
+/*  472 */   {186,53,186,53},
+/*  473 */   {186,53,186,53},
+/*  474 */   {186,53,186,53},
+/*  475 */   {185,52,185,52},
+/*  476 */   {185,52,185,52},
+/*  477 */   {185,52,185,52},
+/*  478 */   {185,51,185,51},
+/*  479 */   {185,51,185,51},
+/*  480 */   {184,51,184,51},
+/*  481 */   {184,50,184,50},
+/*  482 */   {184,50,184,50},
+/*  483 */   {184,49,184,49},
+/*  484 */   {184,49,184,49},
+/*  485 */   {183,49,183,49},
+/*  486 */   {183,48,183,48},
+/*  487 */   {183,48,183,48},
+/*  488 */   {183,48,183,48},
+/*  489 */   {182,47,182,47},
+/*  490 */   {182,47,182,47},
+/*  491 */   {182,46,182,46},
+/*  492 */   {182,46,182,46},
+/*  493 */   {181,46,181,46},
+/*  494 */   {181,45,181,45},
+/*  495 */   {181,45,181,45},
+/*  496 */   {181,45,181,45},
+/*  497 */   {181,44,181,44},
+/*  498 */   {180,44,180,44},
+/*  499 */   {180,44,180,44},
+/*  500 */   {180,43,180,43},
+/*  501 */   {180,43,180,43},
+/*  502 */   {179,43,179,43},
+/*  503 */   {179,42,179,42},
+/*  504 */   {179,42,179,42},
+/*  505 */   {179,42,179,42},
+/*  506 */   {178,41,178,41},
+/*  507 */   {178,41,178,41},
+/*  508 */   {178,41,178,41},
+/*  509 */   {178,40,178,40},
+/*  510 */   {177,40,177,40},
+/*  511 */   {177,40,177,40},
+/*  512 */   {177,39,177,39},
+/*  513 */   {176,39,176,39},
+/*  514 */   {176,38,176,38},
+/*  515 */   {176,38,176,38},
+/*  516 */   {176,38,176,38},
+/*  517 */   {175,37,175,37},
+/*  518 */   {175,37,175,37},
+/*  519 */   {175,37,175,37},
+/*  520 */   {175,37,175,37},
+/*  521 */   {174,36,174,36},
+/*  522 */   {174,36,174,36},
+/*  523 */   {174,36,174,36},
+/*  524 */   {173,35,173,35},
+/*  525 */   {173,35,173,35},
+/*  526 */   {173,35,173,35},
+/*  527 */   {173,34,173,34},
+/*  528 */   {172,34,172,34},
+/*  529 */   {172,34,172,34},
+/*  530 */   {172,33,172,33},
+/*  531 */   {171,33,171,33},
+/*  532 */   {171,33,171,33},
+/*  533 */   {171,32,171,32},
+/*  534 */   {171,32,171,32},
+/*  535 */   {170,32,170,32},
+/*  536 */   {170,32,170,31},
+/*  537 */   {170,32,170,31},
+/*  538 */   {169,32,169,31},
+/*  539 */   {169,32,169,31},
+/*  540 */   {169,31,169,30},
+/*  541 */   {168,31,168,30},
+/*  542 */   {168,31,168,30},
+/*  543 */   {168,30,168,29},
+/*  544 */   {168,30,168,29},
+/*  545 */   {167,30,167,29},
+/*  546 */   {167,29,167,28},
+/*  547 */   {167,29,167,28},
+/*  548 */   {166,29,166,28},
+/*  549 */   {166,29,166,28},
+/*  550 */   {166,28,166,27},
+/*  551 */   {165,28,165,27},
+/*  552 */   {165,28,165,27},
+/*  553 */   {165,27,165,26},
+/*  554 */   {164,27,164,26},
+/*  555 */   {164,27,164,26},
+/*  556 */   {164,27,164,26},
+/*  557 */   {163,26,163,25},
+/*  558 */   {163,26,163,25},
+/*  559 */   {163,26,163,25},
+/*  560 */   {162,25,162,24},
+/*  561 */   {162,25,162,24},
+/*  562 */   {162,25,162,24},
+/*  563 */   {162,25,162,24},
+/*  564 */   {161,24,161,23},
+/*  565 */   {161,24,161,23},
+/*  566 */   {161,24,161,23},
+/*  567 */   {160,24,160,23},
+/*  568 */   {160,23,160,22},
+/*  569 */   {159,23,159,22},
+/*  570 */   {159,23,159,22},
+/*  571 */   {159,22,159,21},
+/*  572 */   {158,22,158,21},
+/*  573 */   {158,22,158,21},
+/*  574 */   {158,22,158,21},
+/*  575 */   {157,21,157,20},
+/*  576 */   {157,21,157,20},
+/*  577 */   {157,21,157,20},
+/*  578 */   {156,21,156,20},
+/*  579 */   {156,20,156,19},
+/*  580 */   {156,20,156,19},
+/*  581 */   {155,20,155,19},
+/*  582 */   {155,20,155,19},
+/*  583 */   {155,19,155,18},
+/*  584 */   {154,19,154,18},
+/*  585 */   {154,19,154,18},
+/*  586 */   {154,19,154,18},
+/*  587 */   {153,19,153,18},
+/*  588 */   {153,18,153,17},
+/*  589 */   {153,18,153,17},
+/*  590 */   {152,18,152,17},
+/*  591 */   {152,18,152,17},
+/*  592 */   {151,17,151,16},
+/*  593 */   {151,17,151,16},
+/*  594 */   {151,17,151,16},
+/*  595 */   {150,17,150,16},
+/*  596 */   {150,16,150,16},
+/*  597 */   {150,16,150,16},
+/*  598 */   {149,16,149,16},
+/*  599 */   {149,16,149,16},
+/*  600 */   {149,16,149,16},
+/*  601 */   {148,15,148,15},
+/*  602 */   {148,15,148,15},
+/*  603 */   {147,15,147,15},
+/*  604 */   {147,15,147,15},
+/*  605 */   {147,15,147,15},
+/*  606 */   {146,14,146,14},
+/*  607 */   {146,14,146,14},
+/*  608 */   {146,14,146,14},
+/*  609 */   {145,14,145,14},
+/*  610 */   {145,14,145,14},
+/*  611 */   {144,13,144,13},
+/*  612 */   {144,13,144,13},
+/*  613 */   {144,13,144,13},
+/*  614 */   {143,13,143,13},
+/*  615 */   {143,13,143,13},
+/*  616 */   {142,12,142,12},
+/*  617 */   {142,12,142,12},
+/*  618 */   {142,12,142,12},
+/*  619 */   {141,12,141,12},
+/*  620 */   {141,12,141,12},
+/*  621 */   {141,12,141,12},
+/*  622 */   {140,11,140,11},
+/*  623 */   {140,11,140,11},
+/*  624 */   {139,11,139,11},
+/*  625 */   {139,11,139,11},
+/*  626 */   {139,11,139,11},
+/*  627 */   {138,10,138,10},
+/*  628 */   {138,10,138,10},
+/*  629 */   {137,10,137,10},
+/*  630 */   {137,10,137,10},
+/*  631 */   {137,10,137,10},
+/*  632 */   {136,10,136,10},
+/*  633 */   {136,9,136,9},
+/*  634 */   {135,9,135,9},
+/*  635 */   {135,9,135,9},
+/*  636 */   {135,9,135,9},
+/*  637 */   {134,9,134,9},
+/*  638 */   {134,9,134,9},
+/*  639 */   {133,9,133,9},
+/*  640 */   {133,8,133,8},
+/*  641 */   {133,8,133,8},
+/*  642 */   {132,8,132,8},
+/*  643 */   {132,8,132,8},
+/*  644 */   {131,8,131,8},
+/*  645 */   {131,8,131,8},
+/*  646 */   {131,8,131,8},
+/*  647 */   {130,7,130,7},
+/*  648 */   {130,7,130,7},
+/*  649 */   {129,7,129,7},
+/*  650 */   {129,7,129,7},
+/*  651 */   {129,7,129,7},
+/*  652 */   {128,7,128,7},
+/*  653 */   {128,7,128,7},
+/*  654 */   {127,7,127,7},
+/*  655 */   {127,6,127,6},
+/*  656 */   {127,6,127,6},
+/*  657 */   {126,6,126,6},
+/*  658 */   {126,6,126,6},
+/*  659 */   {125,6,125,6},
+/*  660 */   {125,6,125,6},
+/*  661 */   {124,6,124,6},
+/*  662 */   {124,6,124,6},
+/*  663 */   {124,6,124,6},
+/*  664 */   {123,5,123,5},
+/*  665 */   {123,5,123,5},
+/*  666 */   {122,5,122,5},
+/*  667 */   {122,5,122,5},
+/*  668 */   {122,5,122,5},
+/*  669 */   {121,5,121,5},
+/*  670 */   {121,5,121,5},
+/*  671 */   {120,5,120,5},
+/*  672 */   {120,5,120,5},
+/*  673 */   {119,5,119,5},
+/*  674 */   {119,4,119,4},
+/*  675 */   {119,4,119,4},
+/*  676 */   {118,4,118,4},
+/*  677 */   {118,4,118,4},
+/*  678 */   {117,4,117,4},
+/*  679 */   {117,4,117,4},
+/*  680 */   {117,4,117,4},
+/*  681 */   {116,4,116,4},
+/*  682 */   {116,4,116,4},
+/*  683 */   {115,4,115,4},
+/*  684 */   {115,4,115,4},
+/*  685 */   {114,4,114,4},
+/*  686 */   {114,4,114,4},
+/*  687 */   {114,4,114,4},
+/*  688 */   {113,3,113,3},
+/*  689 */   {113,3,113,3},
+/*  690 */   {112,3,112,3},
+/*  691 */   {112,3,112,3},
+/*  692 */   {111,3,111,3},
+/*  693 */   {111,3,111,3},
+/*  694 */   {111,3,111,3},
+/*  695 */   {110,3,110,3},
+/*  696 */   {110,3,110,3},
+/*  697 */   {109,3,109,3},
+/*  698 */   {109,3,109,3},
+/*  699 */   {108,3,108,3},
+/*  700 */   {108,3,108,3},
+/*  701 */   {108,3,108,3},
+/*  702 */   {107,3,107,3},
+/*  703 */   {107,3,107,3},
+/*  704 */   {106,3,106,3},
+/*  705 */   {106,3,106,3},
+/*  706 */   {105,3,105,3},
+/*  707 */   {105,3,105,3},
+/*  708 */   {105,3,105,3},
+/*  709 */   {104,3,104,3},
+/*  710 */   {104,3,104,3},
+/*  711 */   {103,3,103,3},
+/*  712 */   {103,3,103,3},
+/*  713 */   {102,3,102,3},
+/*  714 */   {102,3,102,3},
+/*  715 */   {102,3,102,3},
+/*  716 */   {101,3,101,3},
+/*  717 */   {101,3,101,3},
+/*  718 */   {100,3,100,3},
+/*  719 */   {100,3,100,3},
+/*  720 */   {100,2,100,2},
+/*  721 */   {99,3,99,3},
+/*  722 */   {99,3,99,3},
+/*  723 */   {98,3,98,3},
+/*  724 */   {98,3,98,3},
+/*  725 */   {97,3,97,3},
+/*  726 */   {97,3,97,3},
+/*  727 */   {97,3,97,3},
+/*  728 */   {96,3,96,3},
+/*  729 */   {96,3,96,3},
+/*  730 */   {95,3,95,3},
+/*  731 */   {95,3,95,3},
+/*  732 */   {94,3,94,3},
+/*  733 */   {94,3,94,3},
+/*  734 */   {94,3,94,3},
+/*  735 */   {93,3,93,3},
+/*  736 */   {93,3,93,3},
+/*  737 */   {92,3,92,3},
+/*  738 */   {92,3,92,3},
+/*  739 */   {91,3,91,3},
+/*  740 */   {91,3,91,3},
+/*  741 */   {91,3,91,3},
+/*  742 */   {90,3,90,3},
+/*  743 */   {90,3,90,3},
+/*  744 */   {89,3,89,3},
+/*  745 */   {89,3,89,3},
+/*  746 */   {88,3,88,3},
+/*  747 */   {88,3,88,3},
+/*  748 */   {88,3,88,3},
+/*  749 */   {87,3,87,3},
+/*  750 */   {87,3,87,3},
+/*  751 */   {86,3,86,3},
+/*  752 */   {86,3,86,3},
+/*  753 */   {85,4,85,4},
+/*  754 */   {85,4,85,4},
+/*  755 */   {85,4,85,4},
+/*  756 */   {84,4,84,4},
+/*  757 */   {84,4,84,4},
+/*  758 */   {83,4,83,4},
+/*  759 */   {83,4,83,4},
+/*  760 */   {82,4,82,4},
+/*  761 */   {82,4,82,4},
+/*  762 */   {82,4,82,4},
+/*  763 */   {81,4,81,4},
+/*  764 */   {81,4,81,4},
+/*  765 */   {80,4,80,4},
+/*  766 */   {80,4,80,4},
+/*  767 */   {80,5,80,5},
+/*  768 */   {79,5,79,5},
+/*  769 */   {79,5,79,5},
+/*  770 */   {78,5,78,5},
+/*  771 */   {78,5,78,5},
+/*  772 */   {77,5,77,5},
+/*  773 */   {77,5,77,5},
+/*  774 */   {77,5,77,5},
+/*  775 */   {76,5,76,5},
+/*  776 */   {76,5,76,5},
+/*  777 */   {75,6,75,6},
+/*  778 */   {75,6,75,6},
+/*  779 */   {75,6,75,6},
+/*  780 */   {74,6,74,6},
+/*  781 */   {74,6,74,6},
+/*  782 */   {73,6,73,6},
+/*  783 */   {73,6,73,6},
+/*  784 */   {72,6,72,6},
+/*  785 */   {72,6,72,6},
+/*  786 */   {72,7,72,7},
+/*  787 */   {71,7,71,7},
+/*  788 */   {71,7,71,7},
+/*  789 */   {70,7,70,7},
+/*  790 */   {70,7,70,7},
+/*  791 */   {70,7,70,7},
+/*  792 */   {69,7,69,7},
+/*  793 */   {69,7,69,7},
+/*  794 */   {68,8,68,8},
+/*  795 */   {68,8,68,8},
+/*  796 */   {68,8,68,8},
+/*  797 */   {67,8,67,8},
+/*  798 */   {67,8,67,8},
+/*  799 */   {66,8,66,8},
+/*  800 */   {66,8,66,8},
+/*  801 */   {66,9,66,9},
+/*  802 */   {65,9,65,9},
+/*  803 */   {65,9,65,9},
+/*  804 */   {64,9,64,9},
+/*  805 */   {64,9,64,9},
+/*  806 */   {64,9,64,9},
+/*  807 */   {63,9,63,9},
+/*  808 */   {63,10,63,10},
+/*  809 */   {62,10,62,10},
+/*  810 */   {62,10,62,10},
+/*  811 */   {62,10,62,10},
+/*  812 */   {61,10,61,10},
+/*  813 */   {61,10,61,10},
+/*  814 */   {60,11,60,11},
+/*  815 */   {60,11,60,11},
+/*  816 */   {60,11,60,11},
+/*  817 */   {59,11,59,11},
+/*  818 */   {59,11,59,11},
+/*  819 */   {58,12,58,12},
+/*  820 */   {58,12,58,12},
+/*  821 */   {58,12,58,12},
+/*  822 */   {57,12,57,12},
+/*  823 */   {57,12,57,12},
+/*  824 */   {57,12,57,12},
+/*  825 */   {56,13,56,13},
+/*  826 */   {56,13,56,13},
+/*  827 */   {55,13,55,13},
+/*  828 */   {55,13,55,13},
+/*  829 */   {55,13,55,13},
+/*  830 */   {54,14,54,14},
+/*  831 */   {54,14,54,14},
+/*  832 */   {53,14,53,14},
+/*  833 */   {53,14,53,14},
+/*  834 */   {53,14,53,14},
+/*  835 */   {52,15,52,15},
+/*  836 */   {52,15,52,15},
+/*  837 */   {52,15,52,15},
+/*  838 */   {51,15,51,15},
+/*  839 */   {51,15,51,15},
+/*  840 */   {51,16,51,16},
+/*  841 */   {50,16,50,16},
+/*  842 */   {50,16,50,16},
+/*  843 */   {49,16,49,16},
+/*  844 */   {49,16,49,16},
+/*  845 */   {49,17,49,16},
+/*  846 */   {48,17,48,16},
+/*  847 */   {48,17,48,16},
+/*  848 */   {48,17,48,16},
+/*  849 */   {47,18,47,17},
+/*  850 */   {47,18,47,17},
+/*  851 */   {46,18,46,17},
+/*  852 */   {46,18,46,17},
+/*  853 */   {46,19,46,18},
+/*  854 */   {45,19,45,18},
+/*  855 */   {45,19,45,18},
+/*  856 */   {45,19,45,18},
+/*  857 */   {44,19,44,18},
+/*  858 */   {44,20,44,19},
+/*  859 */   {44,20,44,19},
+/*  860 */   {43,20,43,19},
+/*  861 */   {43,20,43,19},
+/*  862 */   {43,21,43,20},
+/*  863 */   {42,21,42,20},
+/*  864 */   {42,21,42,20},
+/*  865 */   {42,21,42,20},
+/*  866 */   {41,22,41,21},
+/*  867 */   {41,22,41,21},
+/*  868 */   {41,22,41,21},
+/*  869 */   {40,22,40,21},
+/*  870 */   {40,23,40,22},
+/*  871 */   {40,23,40,22},
+/*  872 */   {39,23,39,22},
+/*  873 */   {39,24,39,23},
+/*  874 */   {38,24,38,23},
+/*  875 */   {38,24,38,23},
+/*  876 */   {38,24,38,23},
+/*  877 */   {37,25,37,24},
+/*  878 */   {37,25,37,24},
+/*  879 */   {37,25,37,24},
+/*  880 */   {37,25,37,24},
+/*  881 */   {36,26,36,25},
+/*  882 */   {36,26,36,25},
+/*  883 */   {36,26,36,25},
+/*  884 */   {35,27,35,26},
+/*  885 */   {35,27,35,26},
+/*  886 */   {35,27,35,26},
+/*  887 */   {34,27,34,26},
+/*  888 */   {34,28,34,27},
+/*  889 */   {34,28,34,27},
+/*  890 */   {33,28,33,27},
+/*  891 */   {33,29,33,28},
+/*  892 */   {33,29,33,28},
+/*  893 */   {32,29,32,28},
+/*  894 */   {32,29,32,28},
+/*  895 */   {32,30,32,29},
+/*  896 */   {32,30,31,29},
+/*  897 */   {32,30,31,29},
+/*  898 */   {32,31,31,30},
+/*  899 */   {32,31,31,30},
+/*  900 */   {31,31,30,30},
+/*  901 */   {31,32,30,31},
+/*  902 */   {31,32,30,31},
+/*  903 */   {30,32,29,31},
+/*  904 */   {30,32,29,31},
+/*  905 */   {30,32,29,32},
+/*  906 */   {29,32,28,32},
+/*  907 */   {29,32,28,32},
+/*  908 */   {29,33,28,33},
+/*  909 */   {29,33,28,33},
+/*  910 */   {28,33,27,33},
+/*  911 */   {28,34,27,34},
+/*  912 */   {28,34,27,34},
+/*  913 */   {27,34,26,34},
+/*  914 */   {27,35,26,35},
+/*  915 */   {27,35,26,35},
+/*  916 */   {27,35,26,35},
+/*  917 */   {26,36,25,36},
+/*  918 */   {26,36,25,36},
+/*  919 */   {26,36,25,36},
+/*  920 */   {25,37,24,37},
+/*  921 */   {25,37,24,37},
+/*  922 */   {25,37,24,37},
+/*  923 */   {25,37,24,37},
+/*  924 */   {24,38,23,38},
+/*  925 */   {24,38,23,38},
+/*  926 */   {24,38,23,38},
+/*  927 */   {24,39,23,39},
+/*  928 */   {23,39,22,39},
+/*  929 */   {23,40,22,40},
+/*  930 */   {23,40,22,40},
+/*  931 */   {22,40,21,40},
+/*  932 */   {22,41,21,41},
+/*  933 */   {22,41,21,41},
+/*  934 */   {22,41,21,41},
+/*  935 */   {21,42,20,42},
+/*  936 */   {21,42,20,42},
+/*  937 */   {21,42,20,42},
+/*  938 */   {21,43,20,43},
+/*  939 */   {20,43,19,43},
+/*  940 */   {20,43,19,43},
+/*  941 */   {20,44,19,44},
+/*  942 */   {20,44,19,44},
+/*  943 */   {19,44,18,44},
+/*  944 */   {19,45,18,45},
+/*  945 */   {19,45,18,45},
+/*  946 */   {19,45,18,45},
+/*  947 */   {19,46,18,46},
+/*  948 */   {18,46,17,46},
+/*  949 */   {18,46,17,46},
+/*  950 */   {18,47,17,47},
+/*  951 */   {18,47,17,47},
+/*  952 */   {17,48,16,48},
+/*  953 */   {17,48,16,48},
+/*  954 */   {17,48,16,48},
+/*  955 */   {17,49,16,49},
+/*  956 */   {16,49,16,49},
+/*  957 */   {16,49,16,49},
+/*  958 */   {16,50,16,50},
+/*  959 */   {16,50,16,50},
+/*  960 */   {16,51,16,51},
+/*  961 */   {15,51,15,51},
+/*  962 */   {15,51,15,51},
+/*  963 */   {15,52,15,52},
+/*  964 */   {15,52,15,52},
+/*  965 */   {15,52,15,52},
+/*  966 */   {14,53,14,53},
+/*  967 */   {14,53,14,53},
+/*  968 */   {14,53,14,53},
+/*  969 */   {14,54,14,54},
+/*  970 */   {14,54,14,54},
+/*  971 */   {13,55,13,55},
+/*  972 */   {13,55,13,55},
+/*  973 */   {13,55,13,55},
+/*  974 */   {13,56,13,56},
+/*  975 */   {13,56,13,56},
+/*  976 */   {12,57,12,57},
+/*  977 */   {12,57,12,57},
+/*  978 */   {12,57,12,57},
+/*  979 */   {12,58,12,58},
+/*  980 */   {12,58,12,58},
+/*  981 */   {12,58,12,58},
+/*  982 */   {11,59,11,59},
+/*  983 */   {11,59,11,59},
+/*  984 */   {11,60,11,60},
+/*  985 */   {11,60,11,60},
+/*  986 */   {11,60,11,60},
+/*  987 */   {10,61,10,61},
+/*  988 */   {10,61,10,61},
+/*  989 */   {10,62,10,62},
+/*  990 */   {10,62,10,62},
+/*  991 */   {10,62,10,62},
+/*  992 */   {10,63,10,63},
+/*  993 */   {9,63,9,63},
+/*  994 */   {9,64,9,64},
+/*  995 */   {9,64,9,64},
+/*  996 */   {9,64,9,64},
+/*  997 */   {9,65,9,65},
+/*  998 */   {9,65,9,65},
+/*  999 */   {9,66,9,66},
+/* 1000 */   {8,66,8,66},
+/* 1001 */   {8,66,8,66},
+/* 1002 */   {8,67,8,67},
+/* 1003 */   {8,67,8,67},
+/* 1004 */   {8,68,8,68},
+/* 1005 */   {8,68,8,68},
+/* 1006 */   {8,68,8,68},
+/* 1007 */   {7,69,7,69},
+/* 1008 */   {7,69,7,69},
+/* 1009 */   {7,70,7,70},
+/* 1010 */   {7,70,7,70},
+/* 1011 */   {7,70,7,70},
+/* 1012 */   {7,71,7,71},
+/* 1013 */   {7,71,7,71},
+/* 1014 */   {7,72,7,72},
+/* 1015 */   {6,72,6,72},
+/* 1016 */   {6,72,6,72},
+/* 1017 */   {6,73,6,73},
+/* 1018 */   {6,73,6,73},
+/* 1019 */   {6,74,6,74},
+/* 1020 */   {6,74,6,74},
+/* 1021 */   {6,75,6,75},
+/* 1022 */   {6,75,6,75},
+/* 1023 */   {6,75,6,75},
+/* 1024 */   {5,76,5,76},
+/* 1025 */   {5,76,5,76},
+/* 1026 */   {5,77,5,77},
+/* 1027 */   {5,77,5,77},
+/* 1028 */   {5,77,5,77},
+/* 1029 */   {5,78,5,78},
+/* 1030 */   {5,78,5,78},
+/* 1031 */   {5,79,5,79},
+/* 1032 */   {5,79,5,79},
+/* 1033 */   {5,80,5,80},
+/* 1034 */   {4,80,4,80},
+/* 1035 */   {4,80,4,80},
+/* 1036 */   {4,81,4,81},
+/* 1037 */   {4,81,4,81},
+/* 1038 */   {4,82,4,82},
+/* 1039 */   {4,82,4,82},
+/* 1040 */   {4,82,4,82},
+/* 1041 */   {4,83,4,83},
+/* 1042 */   {4,83,4,83},
+/* 1043 */   {4,84,4,84},
+/* 1044 */   {4,84,4,84},
+/* 1045 */   {4,85,4,85},
+/* 1046 */   {4,85,4,85},
+/* 1047 */   {4,85,4,85},
+/* 1048 */   {3,86,3,86},
+/* 1049 */   {3,86,3,86},
+/* 1050 */   {3,87,3,87},
+/* 1051 */   {3,87,3,87},
+/* 1052 */   {3,88,3,88},
+/* 1053 */   {3,88,3,88},
+/* 1054 */   {3,88,3,88},
+/* 1055 */   {3,89,3,89},
+/* 1056 */   {3,89,3,89},
+/* 1057 */   {3,90,3,90},
+/* 1058 */   {3,90,3,90},
+/* 1059 */   {3,91,3,91},
+/* 1060 */   {3,91,3,91},
+/* 1061 */   {3,91,3,91},
+/* 1062 */   {3,92,3,92},
+/* 1063 */   {3,92,3,92},
+/* 1064 */   {3,93,3,93},
+/* 1065 */   {3,93,3,93},
+/* 1066 */   {3,94,3,94},
+/* 1067 */   {3,94,3,94},
+/* 1068 */   {3,94,3,94},
+/* 1069 */   {3,95,3,95},
+/* 1070 */   {3,95,3,95},
+/* 1071 */   {3,96,3,96},
+/* 1072 */   {3,96,3,96},
+/* 1073 */   {3,97,3,97},
+/* 1074 */   {3,97,3,97},
+/* 1075 */   {3,97,3,97},
+/* 1076 */   {3,98,3,98},
+/* 1077 */   {3,98,3,98},
+/* 1078 */   {3,99,3,99},
+/* 1079 */   {3,99,3,99},
+/* 1080 */   {2,100,2,100},
+/* 1081 */   {3,100,3,100},
+/* 1082 */   {3,100,3,100},
+/* 1083 */   {3,101,3,101},
+/* 1084 */   {3,101,3,101},
+/* 1085 */   {3,102,3,102},
+/* 1086 */   {3,102,3,102},
+/* 1087 */   {3,102,3,102},
+/* 1088 */   {3,103,3,103},
+/* 1089 */   {3,103,3,103},
+/* 1090 */   {3,104,3,104},
+/* 1091 */   {3,104,3,104},
+/* 1092 */   {3,105,3,105},
+/* 1093 */   {3,105,3,105},
+/* 1094 */   {3,105,3,105},
+/* 1095 */   {3,106,3,106},
+/* 1096 */   {3,106,3,106},
+/* 1097 */   {3,107,3,107},
+/* 1098 */   {3,107,3,107},
+/* 1099 */   {3,108,3,108},
+/* 1100 */   {3,108,3,108},
+/* 1101 */   {3,108,3,108},
+/* 1102 */   {3,109,3,109},
+/* 1103 */   {3,109,3,109},
+/* 1104 */   {3,110,3,110},
+/* 1105 */   {3,110,3,110},
+/* 1106 */   {3,111,3,111},
+/* 1107 */   {3,111,3,111},
+/* 1108 */   {3,111,3,111},
+/* 1109 */   {3,112,3,112},
+/* 1110 */   {3,112,3,112},
+/* 1111 */   {3,113,3,113},
+/* 1112 */   {3,113,3,113},
+/* 1113 */   {4,114,4,114},
+/* 1114 */   {4,114,4,114},
+/* 1115 */   {4,114,4,114},
+/* 1116 */   {4,115,4,115},
+/* 1117 */   {4,115,4,115},
+/* 1118 */   {4,116,4,116},
+/* 1119 */   {4,116,4,116},
+/* 1120 */   {4,117,4,117},
+/* 1121 */   {4,117,4,117},
+/* 1122 */   {4,117,4,117},
+/* 1123 */   {4,118,4,118},
+/* 1124 */   {4,118,4,118},
+/* 1125 */   {4,119,4,119},
+/* 1126 */   {4,119,4,119},
+/* 1127 */   {5,119,5,119},
+/* 1128 */   {5,120,5,120},
+/* 1129 */   {5,120,5,120},
+/* 1130 */   {5,121,5,121},
+/* 1131 */   {5,121,5,121},
+/* 1132 */   {5,122,5,122},
+/* 1133 */   {5,122,5,122},
+/* 1134 */   {5,122,5,122},
+/* 1135 */   {5,123,5,123},
+/* 1136 */   {5,123,5,123},
+/* 1137 */   {6,124,6,124},
+/* 1138 */   {6,124,6,124},
+/* 1139 */   {6,124,6,124},
+/* 1140 */   {6,125,6,125},
+/* 1141 */   {6,125,6,125},
+/* 1142 */   {6,126,6,126},
+/* 1143 */   {6,126,6,126},
+/* 1144 */   {6,127,6,127},
+/* 1145 */   {6,127,6,127},
+/* 1146 */   {7,127,7,127},
+/* 1147 */   {7,128,7,128},
+/* 1148 */   {7,128,7,128},
+/* 1149 */   {7,129,7,129},
+/* 1150 */   {7,129,7,129},
+/* 1151 */   {7,129,7,129},
+/* 1152 */   {7,130,7,130},
+/* 1153 */   {7,130,7,130},
+/* 1154 */   {8,131,8,131},
+/* 1155 */   {8,131,8,131},
+/* 1156 */   {8,131,8,131},
+/* 1157 */   {8,132,8,132},
+/* 1158 */   {8,132,8,132},
+/* 1159 */   {8,133,8,133},
+/* 1160 */   {8,133,8,133},
+/* 1161 */   {9,133,9,133},
+/* 1162 */   {9,134,9,134},
+/* 1163 */   {9,134,9,134},
+/* 1164 */   {9,135,9,135},
+/* 1165 */   {9,135,9,135},
+/* 1166 */   {9,135,9,135},
+/* 1167 */   {9,136,9,136},
+/* 1168 */   {10,136,10,136},
+/* 1169 */   {10,137,10,137},
+/* 1170 */   {10,137,10,137},
+/* 1171 */   {10,137,10,137},
+/* 1172 */   {10,138,10,138},
+/* 1173 */   {10,138,10,138},
+/* 1174 */   {11,139,11,139},
+/* 1175 */   {11,139,11,139},
+/* 1176 */   {11,139,11,139},
+/* 1177 */   {11,140,11,140},
+/* 1178 */   {11,140,11,140},
+/* 1179 */   {12,141,12,141},
+/* 1180 */   {12,141,12,141},
+/* 1181 */   {12,141,12,141},
+/* 1182 */   {12,142,12,142},
+/* 1183 */   {12,142,12,142},
+/* 1184 */   {12,142,12,142},
+/* 1185 */   {13,143,13,143},
+/* 1186 */   {13,143,13,143},
+/* 1187 */   {13,144,13,144},
+/* 1188 */   {13,144,13,144},
+/* 1189 */   {13,144,13,144},
+/* 1190 */   {14,145,14,145},
+/* 1191 */   {14,145,14,145},
+/* 1192 */   {14,146,14,146},
+/* 1193 */   {14,146,14,146},
+/* 1194 */   {14,146,14,146},
+/* 1195 */   {15,147,15,147},
+/* 1196 */   {15,147,15,147},
+/* 1197 */   {15,147,15,147},
+/* 1198 */   {15,148,15,148},
+/* 1199 */   {15,148,15,148},
+/* 1200 */   {16,149,16,149},
+/* 1201 */   {16,149,16,149},
+/* 1202 */   {16,149,16,149},
+/* 1203 */   {16,150,16,150},
+/* 1204 */   {16,150,16,150},
+/* 1205 */   {17,150,16,150},
+/* 1206 */   {17,151,16,151},
+/* 1207 */   {17,151,16,151},
+/* 1208 */   {17,151,16,151},
+/* 1209 */   {18,152,17,152},
+/* 1210 */   {18,152,17,152},
+/* 1211 */   {18,153,17,153},
+/* 1212 */   {18,153,17,153},
+/* 1213 */   {19,153,18,153},
+/* 1214 */   {19,154,18,154},
+/* 1215 */   {19,154,18,154},
+/* 1216 */   {19,154,18,154},
+/* 1217 */   {19,155,18,155},
+/* 1218 */   {20,155,19,155},
+/* 1219 */   {20,155,19,155},
+/* 1220 */   {20,156,19,156},
+/* 1221 */   {20,156,19,156},
+/* 1222 */   {21,156,20,156},
+/* 1223 */   {21,157,20,157},
+/* 1224 */   {21,157,20,157},
+/* 1225 */   {21,157,20,157},
+/* 1226 */   {22,158,21,158},
+/* 1227 */   {22,158,21,158},
+/* 1228 */   {22,158,21,158},
+/* 1229 */   {22,159,21,159},
+/* 1230 */   {23,159,22,159},
+/* 1231 */   {23,159,22,159},
+/* 1232 */   {23,160,22,160},
+/* 1233 */   {24,160,23,160},
+/* 1234 */   {24,161,23,161},
+/* 1235 */   {24,161,23,161},
+/* 1236 */   {24,161,23,161},
+/* 1237 */   {25,162,24,162},
+/* 1238 */   {25,162,24,162},
+/* 1239 */   {25,162,24,162},
+/* 1240 */   {25,162,24,162},
+/* 1241 */   {26,163,25,163},
+/* 1242 */   {26,163,25,163},
+/* 1243 */   {26,163,25,163},
+/* 1244 */   {27,164,26,164},
+/* 1245 */   {27,164,26,164},
+/* 1246 */   {27,164,26,164},
+/* 1247 */   {27,165,26,165},
+/* 1248 */   {28,165,27,165},
+/* 1249 */   {28,165,27,165},
+/* 1250 */   {28,166,27,166},
+/* 1251 */   {29,166,28,166},
+/* 1252 */   {29,166,28,166},
+/* 1253 */   {29,167,28,167},
+/* 1254 */   {29,167,28,167},
+/* 1255 */   {30,167,29,167},
+/* 1256 */   {30,168,29,168},
+/* 1257 */   {30,168,29,168},
+/* 1258 */   {31,168,30,168},
+/* 1259 */   {31,168,30,168},
+/* 1260 */   {31,169,30,169},
+/* 1261 */   {32,169,31,169},
+/* 1262 */   {32,169,31,169},
+/* 1263 */   {32,170,31,170},
+/* 1264 */   {32,170,31,170},
+/* 1265 */   {32,170,32,170},
+/* 1266 */   {32,171,32,171},
+/* 1267 */   {32,171,32,171},
+/* 1268 */   {33,171,33,171},
+/* 1269 */   {33,171,33,171},
+/* 1270 */   {33,172,33,172},
+/* 1271 */   {34,172,34,172},
+/* 1272 */   {34,172,34,172},
+/* 1273 */   {34,173,34,173},
+/* 1274 */   {35,173,35,173},
+/* 1275 */   {35,173,35,173},
+/* 1276 */   {35,173,35,173},
+/* 1277 */   {36,174,36,174},
+/* 1278 */   {36,174,36,174},
+/* 1279 */   {36,174,36,174},
+/* 1280 */   {37,175,37,175},
+/* 1281 */   {37,175,37,175},
+/* 1282 */   {37,175,37,175},
+/* 1283 */   {37,175,37,175},
+/* 1284 */   {38,176,38,176},
+/* 1285 */   {38,176,38,176},
+/* 1286 */   {38,176,38,176},
+/* 1287 */   {39,176,39,176},
+/* 1288 */   {39,177,39,177},
+/* 1289 */   {40,177,40,177},
+/* 1290 */   {40,177,40,177},
+/* 1291 */   {40,178,40,178},
+/* 1292 */   {41,178,41,178},
+/* 1293 */   {41,178,41,178},
+/* 1294 */   {41,178,41,178},
+/* 1295 */   {42,179,42,179},
+/* 1296 */   {42,179,42,179},
+/* 1297 */   {42,179,42,179},
+/* 1298 */   {43,179,43,179},
+/* 1299 */   {43,180,43,180},
+/* 1300 */   {43,180,43,180},
+/* 1301 */   {44,180,44,180},
+/* 1302 */   {44,180,44,180},
+/* 1303 */   {44,181,44,181},
+/* 1304 */   {45,181,45,181},
+/* 1305 */   {45,181,45,181},
+/* 1306 */   {45,181,45,181},
+/* 1307 */   {46,181,46,181},
+/* 1308 */   {46,182,46,182},
+/* 1309 */   {46,182,46,182},
+/* 1310 */   {47,182,47,182},
+/* 1311 */   {47,182,47,182},
+/* 1312 */   {48,183,48,183},
+/* 1313 */   {48,183,48,183},
+/* 1314 */   {48,183,48,183},
+/* 1315 */   {49,183,49,183},
+/* 1316 */   {49,184,49,184},
+/* 1317 */   {49,184,49,184},
+/* 1318 */   {50,184,50,184},
+/* 1319 */   {50,184,50,184},
+/* 1320 */   {51,184,51,184},
+/* 1321 */   {51,185,51,185},
+/* 1322 */   {51,185,51,185},
+/* 1323 */   {52,185,52,185},
+/* 1324 */   {52,185,52,185},
+/* 1325 */   {52,185,52,185},
+/* 1326 */   {53,186,53,186},
+/* 1327 */   {53,186,53,186},
+/* 1328 */   {53,186,53,186},
+/* 1329 */   {54,186,54,186},
+/* 1330 */   {54,186,54,186},
+/* 1331 */   {55,187,55,187},
+/* 1332 */   {55,187,55,187},
+/* 1333 */   {55,187,55,187},
+/* 1334 */   {56,187,56,187},
+/* 1335 */   {56,187,56,187},
+/* 1336 */   {57,188,57,188},
+/* 1337 */   {57,188,57,188},
+/* 1338 */   {57,188,57,188},
+/* 1339 */   {58,188,58,188},
+/* 1340 */   {58,188,58,188},
+/* 1341 */   {58,188,58,188},
+/* 1342 */   {59,189,59,189},
+/* 1343 */   {59,189,59,189},
+/* 1344 */   {60,189,60,189},
+/* 1345 */   {60,189,60,189},
+/* 1346 */   {60,189,60,189},
+/* 1347 */   {61,190,61,190},
+/* 1348 */   {61,190,61,190},
+/* 1349 */   {62,190,62,190},
+/* 1350 */   {62,190,62,190},
+/* 1351 */   {62,190,62,190},
+/* 1352 */   {63,190,63,190},
+/* 1353 */   {63,191,63,191},
+/* 1354 */   {64,191,64,191},
+/* 1355 */   {64,191,64,191},
+/* 1356 */   {64,191,64,191},
+/* 1357 */   {65,191,65,191},
+/* 1358 */   {65,191,65,191},
+/* 1359 */   {66,191,66,191},
+/* 1360 */   {66,192,66,192},
+/* 1361 */   {66,192,66,192},
+/* 1362 */   {67,192,67,192},
+/* 1363 */   {67,192,67,192},
+/* 1364 */   {68,192,68,192},
+/* 1365 */   {68,192,68,192},
+/* 1366 */   {68,192,68,192},
+/* 1367 */   {69,193,69,193},
+/* 1368 */   {69,193,69,193},
+/* 1369 */   {70,193,70,193},
+/* 1370 */   {70,193,70,193},
+/* 1371 */   {70,193,70,193},
+/* 1372 */   {71,193,71,193},
+/* 1373 */   {71,193,71,193},
+/* 1374 */   {72,193,72,193},
+/* 1375 */   {72,194,72,194},
+/* 1376 */   {72,194,72,194},
+/* 1377 */   {73,194,73,194},
+/* 1378 */   {73,194,73,194},
+/* 1379 */   {74,194,74,194},
+/* 1380 */   {74,194,74,194},
+/* 1381 */   {75,194,75,194},
+/* 1382 */   {75,194,75,194},
+/* 1383 */   {75,194,75,194},
+/* 1384 */   {76,195,76,195},
+/* 1385 */   {76,195,76,195},
+/* 1386 */   {77,195,77,195},
+/* 1387 */   {77,195,77,195},
+/* 1388 */   {77,195,77,195},
+/* 1389 */   {78,195,78,195},
+/* 1390 */   {78,195,78,195},
+/* 1391 */   {79,195,79,195},
+/* 1392 */   {79,195,79,195},
+/* 1393 */   {80,195,80,195},
+/* 1394 */   {80,196,80,196},
+/* 1395 */   {80,196,80,196},
+/* 1396 */   {81,196,81,196},
+/* 1397 */   {81,196,81,196},
+/* 1398 */   {82,196,82,196},
+/* 1399 */   {82,196,82,196},
+/* 1400 */   {82,196,82,196},
+/* 1401 */   {83,196,83,196},
+/* 1402 */   {83,196,83,196},
+/* 1403 */   {84,196,84,196},
+/* 1404 */   {84,196,84,196},
+/* 1405 */   {85,196,85,196},
+/* 1406 */   {85,196,85,196},
+/* 1407 */   {85,196,85,196},
+/* 1408 */   {86,197,86,197},
+/* 1409 */   {86,197,86,197},
+/* 1410 */   {87,197,87,197},
+/* 1411 */   {87,197,87,197},
+/* 1412 */   {88,197,88,197},
+/* 1413 */   {88,197,88,197},
+/* 1414 */   {88,197,88,197},
+/* 1415 */   {89,197,89,197},
+/* 1416 */   {89,197,89,197},
+/* 1417 */   {90,197,90,197},
+/* 1418 */   {90,197,90,197},
+/* 1419 */   {91,197,91,197},
+/* 1420 */   {91,197,91,197},
+/* 1421 */   {91,197,91,197},
+/* 1422 */   {92,197,92,197},
+/* 1423 */   {92,197,92,197},
+/* 1424 */   {93,197,93,197},
+/* 1425 */   {93,197,93,197},
+/* 1426 */   {94,197,94,197},
+/* 1427 */   {94,197,94,197},
+/* 1428 */   {94,197,94,197},
+/* 1429 */   {95,197,95,197},
+/* 1430 */   {95,197,95,197},
+/* 1431 */   {96,197,96,197},
+/* 1432 */   {96,197,96,197},
+/* 1433 */   {97,197,97,197},
+/* 1434 */   {97,197,97,197},
+/* 1435 */   {97,197,97,197},
+/* 1436 */   {98,197,98,197},
+/* 1437 */   {98,197,98,197},
+/* 1438 */   {99,197,99,197},
+/* 1439 */   {99,197,99,197}
+};
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef PACKED_BITMAPS_H
+#define PACKED_BITMAPS_H
+
+// Generated by tools/packbits.py from: assets.h:backgroundMask assets.h:backgroundRing
+// Draw with FrameBuffer::drawPackedBitmapWindow. Total 10000 -> 2819 bytes.
+
+// 'backgroundMask', 200x200px, packbits 5000 -> 1293 bytes
+const unsigned char backgroundMaskPacked [] PROGMEM = {
+	0xc3, 0xff, 0x00, 0xc3, 0xeb, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x3f, 0xed, 0xff, 0x00, 0x80, 
+	0xfd, 0x00, 0xee, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x0f, 0xef, 0xff, 0xfa, 0x00, 0xf0, 0xff, 
+	0x00, 0xf8, 0xfa, 0x00, 0x00, 0x1f, 0xf1, 0xff, 0x00, 0xc0, 0xfa, 0x00, 0x00, 0x03, 0xf1, 0xff, 
+	0xf8, 0x00, 0xf2, 0xff, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x1f, 0xf3, 0xff, 0x00, 0xe0, 0xf8, 0x00, 
+	0x00, 0x07, 0xf3, 0xff, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x01, 0xf4, 0xff, 0x00, 0xfe, 0xf6, 0x00, 
+	0x00, 0x7f, 0xf5, 0xff, 0x00, 0xf8, 0xf6, 0x00, 0x00, 0x1f, 0xf5, 0xff, 0x00, 0xe0, 0xf6, 0x00, 
+	0x00, 0x07, 0xf5, 0xff, 0x00, 0xc0, 0xf6, 0x00, 0x00, 0x03, 0xf5, 0xff, 0xf4, 0x00, 0xf6, 0xff, 
+	0x00, 0xfc, 0xf4, 0x00, 0x00, 0x3f, 0xf7, 0xff, 0x00, 0xf8, 0xf4, 0x00, 0x00, 0x1f, 0xf7, 0xff, 
+	0x00, 0xe0, 0xf4, 0x00, 0x00, 0x07, 0xf7, 0xff, 0x00, 0xc0, 0xf4, 0x00, 0x00, 0x03, 0xf7, 0xff, 
+	0x00, 0x80, 0xf4, 0x00, 0x00, 0x01, 0xf7, 0xff, 0xf2, 0x00, 0xf8, 0xff, 0x00, 0xfc, 0xf2, 0x00, 
+	0x00, 0x3f, 0xf9, 0xff, 0x00, 0xf8, 0xf2, 0x00, 0x00, 0x1f, 0xf9, 0xff, 0x00, 0xf0, 0xf2, 0x00, 
+	0x00, 0x0f, 0xf9, 0xff, 0x00, 0xe0, 0xf2, 0x00, 0x00, 0x07, 0xf9, 0xff, 0x00, 0xc0, 0xf2, 0x00, 
+	0x00, 0x03, 0xf9, 0xff, 0x00, 0x80, 0xf2, 0x00, 0x00, 0x01, 0xfa, 0xff, 0x00, 0xfe, 0xf0, 0x00, 
+	0x00, 0x7f, 0xfb, 0xff, 0x00, 0xfc, 0xf0, 0x00, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xf0, 0x00, 
+	0x00, 0x3f, 0xfb, 0xff, 0x00, 0xf8, 0xf0, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xf0, 0xf0, 0x00, 
+	0x00, 0x0f, 0xfb, 0xff, 0x00, 0xe0, 0xf0, 0x00, 0x00, 0x07, 0xfb, 0xff, 0x00, 0xc0, 0xf0, 0x00, 
+	0x00, 0x03, 0xfb, 0xff, 0x00, 0x80, 0xf0, 0x00, 0x00, 0x01, 0xfb, 0xff, 0xee, 0x00, 0xfb, 0xff, 
+	0xee, 0x00, 0xfc, 0xff, 0x00, 0xfe, 0xee, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xfc, 0xee, 0x00, 
+	0x00, 0x3f, 0xfd, 0xff, 0x00, 0xf8, 0xee, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x00, 0xf0, 0xee, 0x00, 
+	0x00, 0x0f, 0xfd, 0xff, 0x00, 0xf0, 0xee, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x00, 0xe0, 0xee, 0x00, 
+	0x00, 0x07, 0xfd, 0xff, 0x00, 0xc0, 0xee, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xc0, 0xee, 0x00, 
+	0x00, 0x03, 0xfd, 0xff, 0x00, 0x80, 0xee, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x00, 0x80, 0xee, 0x00, 
+	0x00, 0x01, 0xfd, 0xff, 0xec, 0x00, 0xfe, 0xff, 0x00, 0xfe, 0xec, 0x00, 0x00, 0x7f, 0xff, 0xff, 
+	0x00, 0xfe, 0xec, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x00, 0xfc, 0xec, 0x00, 0x00, 0x3f, 0xff, 0xff, 
+	0x00, 0xfc, 0xec, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x00, 0xf8, 0xec, 0x00, 0x00, 0x1f, 0xff, 0xff, 
+	0x00, 0xf8, 0xec, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0xff, 
+	0x00, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0xe0, 0xec, 0x00, 0x00, 0x07, 0xff, 0xff, 
+	0x00, 0xe0, 0xec, 0x00, 0x00, 0x07, 0xff, 0xff, 0x00, 0xc0, 0xec, 0x00, 0x00, 0x03, 0xff, 0xff, 
+	0x00, 0xc0, 0xec, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0xc0, 0xec, 0x00, 0x00, 0x03, 0xff, 0xff, 
+	0x00, 0x80, 0xec, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x80, 0xec, 0x00, 0x00, 0x01, 0xff, 0xff, 
+	0xea, 0x00, 0xff, 0xff, 0xea, 0x00, 0xff, 0xff, 0xea, 0x00, 0x01, 0xff, 0xfe, 0xea, 0x00, 0x01, 
+	0x7f, 0xfe, 0xea, 0x00, 0x01, 0x7f, 0xfe, 0xea, 0x00, 0x01, 0x7f, 0xfc, 0xea, 0x00, 0x01, 0x3f, 
+	0xfc, 0xea, 0x00, 0x01, 0x3f, 0xfc, 0xea, 0x00, 0x01, 0x3f, 0xfc, 0xea, 0x00, 0x01, 0x3f, 0xf8, 
+	0xea, 0x00, 0x01, 0x1f, 0xf8, 0xea, 0x00, 0x01, 0x1f, 0xf8, 0xea, 0x00, 0x01, 0x1f, 0xf8, 0xea, 
+	0x00, 0x01, 0x1f, 0xf0, 0xea, 0x00, 0x01, 0x1f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf0, 0xea, 0x00, 
+	0x01, 0x0f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf0, 0xea, 0x00, 0x01, 
+	0x0f, 0xe0, 0xea, 0x00, 0x01, 0x0f, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 
+	0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 
+	0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 
+	0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xc0, 0xea, 0x00, 
+	0x01, 0x03, 0xc0, 0xea, 0x00, 0x01, 0x03, 0xc0, 0xea, 0x00, 0x01, 0x03, 0xc0, 0xea, 0x00, 0x01, 
+	0x03, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 
+	0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 
+	0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xe0, 0xea, 
+	0x00, 0x01, 0x07, 0xe0, 0xea, 0x00, 0x01, 0x07, 0xf0, 0xea, 0x00, 0x01, 0x07, 0xf0, 0xea, 0x00, 
+	0x01, 0x0f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf0, 0xea, 0x00, 0x01, 
+	0x0f, 0xf0, 0xea, 0x00, 0x01, 0x0f, 0xf8, 0xea, 0x00, 0x01, 0x0f, 0xf8, 0xea, 0x00, 0x01, 0x1f, 
+	0xf8, 0xea, 0x00, 0x01, 0x1f, 0xf8, 0xea, 0x00, 0x01, 0x1f, 0xf8, 0xea, 0x00, 0x01, 0x1f, 0xfc, 
+	0xea, 0x00, 0x01, 0x3f, 0xfc, 0xea, 0x00, 0x01, 0x3f, 0xfc, 0xea, 0x00, 0x01, 0x3f, 0xfc, 0xea, 
+	0x00, 0x01, 0x3f, 0xfe, 0xea, 0x00, 0x01, 0x7f, 0xfe, 0xea, 0x00, 0x01, 0x7f, 0xfe, 0xea, 0x00, 
+	0x01, 0x7f, 0xff, 0xea, 0x00, 0xff, 0xff, 0xea, 0x00, 0xff, 0xff, 0xea, 0x00, 0xff, 0xff, 0x00, 
+	0x80, 0xec, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x80, 0xec, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 
+	0xc0, 0xec, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0xc0, 0xec, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 
+	0xc0, 0xec, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0xe0, 0xec, 0x00, 0x00, 0x07, 0xff, 0xff, 0x00, 
+	0xe0, 0xec, 0x00, 0x00, 0x07, 0xff, 0xff, 0x00, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 
+	0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0xf8, 0xec, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 
+	0xf8, 0xec, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0xfc, 0xec, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x00, 
+	0xfc, 0xec, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x00, 0xfe, 0xec, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x00, 
+	0xfe, 0xec, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0xec, 0x00, 0xfd, 0xff, 0x00, 0x80, 0xee, 0x00, 0x00, 
+	0x01, 0xfd, 0xff, 0x00, 0x80, 0xee, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x00, 0xc0, 0xee, 0x00, 0x00, 
+	0x03, 0xfd, 0xff, 0x00, 0xc0, 0xee, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xe0, 0xee, 0x00, 0x00, 
+	0x07, 0xfd, 0xff, 0x00, 0xf0, 0xee, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x00, 0xf0, 0xee, 0x00, 0x00, 
+	0x0f, 0xfd, 0xff, 0x00, 0xf8, 0xee, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x00, 0xfc, 0xee, 0x00, 0x00, 
+	0x3f, 0xfd, 0xff, 0x00, 0xfe, 0xee, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0xee, 0x00, 0xfb, 0xff, 0xee, 
+	0x00, 0xfb, 0xff, 0x00, 0x80, 0xf0, 0x00, 0x00, 0x01, 0xfb, 0xff, 0x00, 0xc0, 0xf0, 0x00, 0x00, 
+	0x03, 0xfb, 0xff, 0x00, 0xe0, 0xf0, 0x00, 0x00, 0x07, 0xfb, 0xff, 0x00, 0xf0, 0xf0, 0x00, 0x00, 
+	0x0f, 0xfb, 0xff, 0x00, 0xf8, 0xf0, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xfc, 0xf0, 0x00, 0x00, 
+	0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xf0, 0x00, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfe, 0xf0, 0x00, 0x00, 
+	0x7f, 0xfa, 0xff, 0x00, 0x80, 0xf2, 0x00, 0x00, 0x01, 0xf9, 0xff, 0x00, 0xc0, 0xf2, 0x00, 0x00, 
+	0x03, 0xf9, 0xff, 0x00, 0xe0, 0xf2, 0x00, 0x00, 0x07, 0xf9, 0xff, 0x00, 0xf0, 0xf2, 0x00, 0x00, 
+	0x0f, 0xf9, 0xff, 0x00, 0xf8, 0xf2, 0x00, 0x00, 0x1f, 0xf9, 0xff, 0x00, 0xfc, 0xf2, 0x00, 0x00, 
+	0x3f, 0xf8, 0xff, 0xf2, 0x00, 0xf7, 0xff, 0x00, 0x80, 0xf4, 0x00, 0x00, 0x01, 0xf7, 0xff, 0x00, 
+	0xc0, 0xf4, 0x00, 0x00, 0x03, 0xf7, 0xff, 0x00, 0xe0, 0xf4, 0x00, 0x00, 0x07, 0xf7, 0xff, 0x00, 
+	0xf8, 0xf4, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0x00, 0xfc, 0xf4, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0xf4, 
+	0x00, 0xf5, 0xff, 0x00, 0xc0, 0xf6, 0x00, 0x00, 0x03, 0xf5, 0xff, 0x00, 0xe0, 0xf6, 0x00, 0x00, 
+	0x07, 0xf5, 0xff, 0x00, 0xf8, 0xf6, 0x00, 0x00, 0x1f, 0xf5, 0xff, 0x00, 0xfe, 0xf6, 0x00, 0x00, 
+	0x7f, 0xf4, 0xff, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x01, 0xf3, 0xff, 0x00, 0xe0, 0xf8, 0x00, 0x00, 
+	0x07, 0xf3, 0xff, 0x00, 0xf8, 0xf8, 0x00, 0x00, 0x1f, 0xf2, 0xff, 0xf8, 0x00, 0xf1, 0xff, 0x00, 
+	0xc0, 0xfa, 0x00, 0x00, 0x03, 0xf1, 0xff, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0xfa, 
+	0x00, 0xef, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x0f, 0xee, 0xff, 0xfd, 0x00, 0x00, 0x01, 0xed, 
+	0xff, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x7f, 0xeb, 0xff, 0x00, 0xc3, 0xc3, 0xff
+};
+// 'backgroundRing', 200x200px, packbits 5000 -> 1526 bytes
+const unsigned char backgroundRingPacked [] PROGMEM = {
+	0xc4, 0x00, 0xfe, 0xff, 0xec, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xfc, 0xee, 0x00, 0x00, 0x07, 
+	0xfc, 0xff, 0x00, 0xe0, 0xef, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x00, 0xfe, 0xf0, 0x00, 0x02, 0x07, 
+	0xff, 0xfe, 0xfe, 0x00, 0x02, 0x3f, 0xff, 0xc0, 0xf1, 0x00, 0x02, 0x3f, 0xff, 0x80, 0xfe, 0x00, 
+	0x02, 0x01, 0xff, 0xf8, 0xf1, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x01, 0x0f, 0xff, 0xf2, 0x00, 
+	0x02, 0x03, 0xff, 0x80, 0xfb, 0x00, 0x01, 0xff, 0xc0, 0xf3, 0x00, 0x01, 0x1f, 0xfc, 0xfa, 0x00, 
+	0x01, 0x1f, 0xf8, 0xf3, 0x00, 0x01, 0x7f, 0xe0, 0xfa, 0x00, 0x01, 0x07, 0xfe, 0xf4, 0x00, 0x01, 
+	0x01, 0xff, 0xf8, 0x00, 0x01, 0xff, 0x80, 0xf5, 0x00, 0x01, 0x07, 0xfc, 0xf8, 0x00, 0x01, 0x3f, 
+	0xe0, 0xf5, 0x00, 0x01, 0x1f, 0xf0, 0xf8, 0x00, 0x01, 0x0f, 0xf8, 0xf5, 0x00, 0x01, 0x3f, 0xc0, 
+	0xf8, 0x00, 0x01, 0x03, 0xfc, 0xf5, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x01, 
+	0x03, 0xfc, 0xf6, 0x00, 0x01, 0x3f, 0xc0, 0xf7, 0x00, 0x01, 0x07, 0xf0, 0xf6, 0x00, 0x01, 0x0f, 
+	0xe0, 0xf7, 0x00, 0x01, 0x1f, 0xc0, 0xf6, 0x00, 0x01, 0x03, 0xf8, 0xf7, 0x00, 0x01, 0x3f, 0x80, 
+	0xf6, 0x00, 0x01, 0x01, 0xfc, 0xf7, 0x00, 0x00, 0x7e, 0xf4, 0x00, 0x00, 0x7e, 0xf8, 0x00, 0x01, 
+	0x01, 0xfc, 0xf4, 0x00, 0x01, 0x3f, 0x80, 0xf9, 0x00, 0x01, 0x03, 0xf0, 0xf4, 0x00, 0x01, 0x0f, 
+	0xc0, 0xf9, 0x00, 0x01, 0x07, 0xe0, 0xf4, 0x00, 0x01, 0x07, 0xe0, 0xf9, 0x00, 0x01, 0x0f, 0xc0, 
+	0xf4, 0x00, 0x01, 0x03, 0xf0, 0xf9, 0x00, 0x01, 0x1f, 0x80, 0xf4, 0x00, 0x01, 0x01, 0xf8, 0xf9, 
+	0x00, 0x00, 0x3e, 0xf2, 0x00, 0x00, 0x7c, 0xf9, 0x00, 0x00, 0xfc, 0xf2, 0x00, 0x00, 0x3f, 0xfa, 
+	0x00, 0x01, 0x01, 0xf8, 0xf2, 0x00, 0x01, 0x1f, 0x80, 0xfb, 0x00, 0x01, 0x03, 0xf0, 0xf2, 0x00, 
+	0x01, 0x0f, 0xc0, 0xfb, 0x00, 0x01, 0x07, 0xe0, 0xf2, 0x00, 0x01, 0x07, 0xe0, 0xfb, 0x00, 0x01, 
+	0x0f, 0xc0, 0xf2, 0x00, 0x01, 0x03, 0xf0, 0xfb, 0x00, 0x01, 0x0f, 0x80, 0xf2, 0x00, 0x01, 0x01, 
+	0xf0, 0xfb, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x00, 0xf8, 0xfb, 0x00, 0x00, 0x3e, 0xf0, 0x00, 0x00, 
+	0x7c, 0xfb, 0x00, 0x00, 0x7c, 0xf0, 0x00, 0x00, 0x3e, 0xfb, 0x00, 0x00, 0xf8, 0xf0, 0x00, 0x00, 
+	0x1f, 0xfc, 0x00, 0x01, 0x01, 0xf0, 0xf0, 0x00, 0x01, 0x0f, 0x80, 0xfd, 0x00, 0x01, 0x03, 0xe0, 
+	0xf0, 0x00, 0x01, 0x07, 0xc0, 0xfd, 0x00, 0x01, 0x03, 0xe0, 0xf0, 0x00, 0x01, 0x07, 0xc0, 0xfd, 
+	0x00, 0x01, 0x07, 0xc0, 0xf0, 0x00, 0x01, 0x03, 0xe0, 0xfd, 0x00, 0x01, 0x0f, 0x80, 0xf0, 0x00, 
+	0x01, 0x01, 0xf0, 0xfd, 0x00, 0x00, 0x1f, 0xee, 0x00, 0x00, 0xf8, 0xfd, 0x00, 0x00, 0x1e, 0xee, 
+	0x00, 0x00, 0x78, 0xfd, 0x00, 0x00, 0x3e, 0xee, 0x00, 0x00, 0x7c, 0xfd, 0x00, 0x00, 0x7c, 0xee, 
+	0x00, 0x00, 0x3e, 0xfd, 0x00, 0x00, 0x78, 0xee, 0x00, 0x00, 0x1e, 0xfd, 0x00, 0x00, 0xf8, 0xee, 
+	0x00, 0x00, 0x1f, 0xfd, 0x00, 0x00, 0xf0, 0xee, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x01, 0x01, 0xe0, 
+	0xee, 0x00, 0x01, 0x07, 0x80, 0xff, 0x00, 0x01, 0x03, 0xe0, 0xee, 0x00, 0x01, 0x07, 0xc0, 0xff, 
+	0x00, 0x01, 0x03, 0xc0, 0xee, 0x00, 0x01, 0x03, 0xc0, 0xff, 0x00, 0x01, 0x07, 0xc0, 0xee, 0x00, 
+	0x01, 0x03, 0xe0, 0xff, 0x00, 0x01, 0x07, 0x80, 0xee, 0x00, 0x01, 0x01, 0xe0, 0xff, 0x00, 0x01, 
+	0x0f, 0x80, 0xee, 0x00, 0x01, 0x01, 0xf0, 0xff, 0x00, 0x00, 0x0f, 0xec, 0x00, 0x00, 0xf0, 0xff, 
+	0x00, 0x00, 0x1f, 0xec, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x1e, 0xec, 0x00, 0x00, 0x78, 0xff, 
+	0x00, 0x00, 0x3e, 0xec, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x3c, 0xec, 0x00, 0x00, 0x3c, 0xff, 
+	0x00, 0x00, 0x3c, 0xec, 0x00, 0x00, 0x3c, 0xff, 0x00, 0x00, 0x78, 0xec, 0x00, 0x00, 0x1e, 0xff, 
+	0x00, 0x00, 0x78, 0xec, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x00, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 
+	0x00, 0x00, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xf0, 0xec, 0x00, 0x03, 0x0f, 0x80, 
+	0x01, 0xe0, 0xec, 0x00, 0x03, 0x07, 0x80, 0x01, 0xe0, 0xec, 0x00, 0x03, 0x07, 0x80, 0x01, 0xc0, 
+	0xec, 0x00, 0x03, 0x07, 0xc0, 0x03, 0xc0, 0xec, 0x00, 0x03, 0x03, 0xc0, 0x03, 0xc0, 0xec, 0x00, 
+	0x03, 0x03, 0xc0, 0x03, 0x80, 0xec, 0x00, 0x03, 0x03, 0xc0, 0x07, 0x80, 0xec, 0x00, 0x03, 0x01, 
+	0xe0, 0x07, 0x80, 0xec, 0x00, 0x03, 0x01, 0xe0, 0x07, 0x80, 0xec, 0x00, 0x02, 0x01, 0xe0, 0x07, 
+	0xea, 0x00, 0x01, 0xe0, 0x0f, 0xea, 0x00, 0x01, 0xf0, 0x0f, 0xea, 0x00, 0x01, 0xf0, 0x0f, 0xea, 
+	0x00, 0x01, 0xf0, 0x0f, 0xea, 0x00, 0x01, 0xf0, 0x0e, 0xea, 0x00, 0x01, 0x78, 0x1e, 0xea, 0x00, 
+	0x01, 0x78, 0x1e, 0xea, 0x00, 0x01, 0x78, 0x1e, 0xea, 0x00, 0x01, 0x78, 0x1e, 0xea, 0x00, 0x01, 
+	0x78, 0x1c, 0xea, 0x00, 0x01, 0x78, 0x1c, 0xea, 0x00, 0x01, 0x38, 0x3c, 0xea, 0x00, 0xff, 0x3c, 
+	0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 
+	0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 
+	0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 
+	0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 
+	0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 
+	0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0xff, 0x3c, 0xea, 0x00, 0x01, 0x3c, 0x1c, 0xea, 0x00, 0x01, 
+	0x38, 0x1e, 0xea, 0x00, 0x01, 0x38, 0x1e, 0xea, 0x00, 0x01, 0x78, 0x1e, 0xea, 0x00, 0x01, 0x78, 
+	0x1e, 0xea, 0x00, 0x01, 0x78, 0x1e, 0xea, 0x00, 0x01, 0x78, 0x1e, 0xea, 0x00, 0x01, 0x70, 0x0f, 
+	0xea, 0x00, 0x01, 0xf0, 0x0f, 0xea, 0x00, 0x01, 0xf0, 0x0f, 0xea, 0x00, 0x01, 0xf0, 0x0f, 0xea, 
+	0x00, 0x01, 0xf0, 0x07, 0xea, 0x00, 0x02, 0xe0, 0x07, 0x80, 0xec, 0x00, 0x03, 0x01, 0xe0, 0x07, 
+	0x80, 0xec, 0x00, 0x03, 0x01, 0xe0, 0x07, 0x80, 0xec, 0x00, 0x03, 0x01, 0xe0, 0x03, 0xc0, 0xec, 
+	0x00, 0x03, 0x01, 0xc0, 0x03, 0xc0, 0xec, 0x00, 0x03, 0x03, 0xc0, 0x03, 0xc0, 0xec, 0x00, 0x03, 
+	0x03, 0xc0, 0x03, 0xe0, 0xec, 0x00, 0x03, 0x03, 0x80, 0x01, 0xe0, 0xec, 0x00, 0x03, 0x07, 0x80, 
+	0x01, 0xe0, 0xec, 0x00, 0x03, 0x07, 0x80, 0x01, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 
+	0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0xf0, 0xec, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 
+	0x78, 0xec, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x00, 0x78, 0xec, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x00, 
+	0x3c, 0xec, 0x00, 0x00, 0x3c, 0xff, 0x00, 0x00, 0x3c, 0xec, 0x00, 0x00, 0x3c, 0xff, 0x00, 0x00, 
+	0x3e, 0xec, 0x00, 0x00, 0x7c, 0xff, 0x00, 0x00, 0x1e, 0xec, 0x00, 0x00, 0x78, 0xff, 0x00, 0x00, 
+	0x1f, 0xec, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x0f, 0xec, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x01, 
+	0x0f, 0x80, 0xee, 0x00, 0x01, 0x01, 0xf0, 0xff, 0x00, 0x01, 0x07, 0x80, 0xee, 0x00, 0x01, 0x01, 
+	0xe0, 0xff, 0x00, 0x01, 0x07, 0xc0, 0xee, 0x00, 0x01, 0x03, 0xe0, 0xff, 0x00, 0x01, 0x03, 0xc0, 
+	0xee, 0x00, 0x01, 0x03, 0xc0, 0xff, 0x00, 0x01, 0x03, 0xe0, 0xee, 0x00, 0x01, 0x07, 0xc0, 0xff, 
+	0x00, 0x01, 0x01, 0xe0, 0xee, 0x00, 0x01, 0x07, 0x80, 0xfe, 0x00, 0x00, 0xf0, 0xee, 0x00, 0x00, 
+	0x0f, 0xfd, 0x00, 0x00, 0xf8, 0xee, 0x00, 0x00, 0x1f, 0xfd, 0x00, 0x00, 0x78, 0xee, 0x00, 0x00, 
+	0x1e, 0xfd, 0x00, 0x00, 0x7c, 0xee, 0x00, 0x00, 0x3e, 0xfd, 0x00, 0x00, 0x3e, 0xee, 0x00, 0x00, 
+	0x7c, 0xfd, 0x00, 0x00, 0x1e, 0xee, 0x00, 0x00, 0x78, 0xfd, 0x00, 0x00, 0x1f, 0xee, 0x00, 0x00, 
+	0xf8, 0xfd, 0x00, 0x01, 0x0f, 0x80, 0xf0, 0x00, 0x01, 0x01, 0xf0, 0xfd, 0x00, 0x01, 0x07, 0xc0, 
+	0xf0, 0x00, 0x01, 0x03, 0xe0, 0xfd, 0x00, 0x01, 0x03, 0xe0, 0xf0, 0x00, 0x01, 0x07, 0xc0, 0xfd, 
+	0x00, 0x01, 0x03, 0xe0, 0xf0, 0x00, 0x01, 0x07, 0xc0, 0xfd, 0x00, 0x01, 0x01, 0xf0, 0xf0, 0x00, 
+	0x01, 0x0f, 0x80, 0xfc, 0x00, 0x00, 0xf8, 0xf0, 0x00, 0x00, 0x1f, 0xfb, 0x00, 0x00, 0x7c, 0xf0, 
+	0x00, 0x00, 0x3e, 0xfb, 0x00, 0x00, 0x3e, 0xf0, 0x00, 0x00, 0x7c, 0xfb, 0x00, 0x00, 0x1f, 0xf0, 
+	0x00, 0x00, 0xf8, 0xfb, 0x00, 0x01, 0x0f, 0x80, 0xf2, 0x00, 0x01, 0x01, 0xf0, 0xfb, 0x00, 0x01, 
+	0x0f, 0xc0, 0xf2, 0x00, 0x01, 0x03, 0xf0, 0xfb, 0x00, 0x01, 0x07, 0xe0, 0xf2, 0x00, 0x01, 0x07, 
+	0xe0, 0xfb, 0x00, 0x01, 0x03, 0xf0, 0xf2, 0x00, 0x01, 0x0f, 0xc0, 0xfb, 0x00, 0x01, 0x01, 0xf8, 
+	0xf2, 0x00, 0x01, 0x1f, 0x80, 0xfa, 0x00, 0x00, 0xfc, 0xf2, 0x00, 0x00, 0x3f, 0xf9, 0x00, 0x00, 
+	0x3e, 0xf2, 0x00, 0x00, 0x7c, 0xf9, 0x00, 0x01, 0x1f, 0x80, 0xf4, 0x00, 0x01, 0x01, 0xf8, 0xf9, 
+	0x00, 0x01, 0x0f, 0xc0, 0xf4, 0x00, 0x01, 0x03, 0xf0, 0xf9, 0x00, 0x01, 0x07, 0xe0, 0xf4, 0x00, 
+	0x01, 0x07, 0xe0, 0xf9, 0x00, 0x01, 0x03, 0xf0, 0xf4, 0x00, 0x01, 0x0f, 0xc0, 0xf9, 0x00, 0x01, 
+	0x01, 0xfc, 0xf4, 0x00, 0x01, 0x3f, 0x80, 0xf8, 0x00, 0x00, 0x7e, 0xf4, 0x00, 0x00, 0x7e, 0xf7, 
+	0x00, 0x01, 0x3f, 0x80, 0xf6, 0x00, 0x01, 0x01, 0xfc, 0xf7, 0x00, 0x01, 0x1f, 0xc0, 0xf6, 0x00, 
+	0x01, 0x03, 0xf8, 0xf7, 0x00, 0x01, 0x07, 0xf0, 0xf6, 0x00, 0x01, 0x0f, 0xe0, 0xf7, 0x00, 0x01, 
+	0x03, 0xfc, 0xf6, 0x00, 0x01, 0x3f, 0xc0, 0xf6, 0x00, 0x00, 0xff, 0xf6, 0x00, 0x00, 0xff, 0xf5, 
+	0x00, 0x01, 0x3f, 0xc0, 0xf8, 0x00, 0x01, 0x03, 0xfc, 0xf5, 0x00, 0x01, 0x1f, 0xf0, 0xf8, 0x00, 
+	0x01, 0x0f, 0xf8, 0xf5, 0x00, 0x01, 0x07, 0xfc, 0xf8, 0x00, 0x01, 0x3f, 0xe0, 0xf5, 0x00, 0x01, 
+	0x01, 0xff, 0xf8, 0x00, 0x01, 0xff, 0x80, 0xf4, 0x00, 0x01, 0x7f, 0xe0, 0xfa, 0x00, 0x01, 0x07, 
+	0xfe, 0xf3, 0x00, 0x01, 0x1f, 0xf8, 0xfa, 0x00, 0x01, 0x3f, 0xf8, 0xf3, 0x00, 0x01, 0x03, 0xff, 
+	0xfb, 0x00, 0x02, 0x01, 0xff, 0xc0, 0xf2, 0x00, 0x01, 0xff, 0xf0, 0xfc, 0x00, 0x01, 0x0f, 0xff, 
+	0xf1, 0x00, 0x02, 0x1f, 0xff, 0x80, 0xfe, 0x00, 0x02, 0x01, 0xff, 0xfc, 0xf1, 0x00, 0x02, 0x03, 
+	0xff, 0xfc, 0xfe, 0x00, 0x02, 0x7f, 0xff, 0xe0, 0xf0, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x00, 0xfe, 
+	0xef, 0x00, 0x00, 0x07, 0xfc, 0xff, 0x00, 0xe0, 0xee, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xfe, 
+	0xec, 0x00, 0xfe, 0xff, 0xc4, 0x00
+};
+
+#endif
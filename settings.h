@@ -14,6 +14,16 @@
 #define NTP_SERVER "pool.ntp.org"
 #define GMT_OFFSET_SEC 3600 * -5 //New York is UTC -5
 #define DST_OFFSET_SEC 3600
+//Location Settings
+//Uncomment to work out sunrise/sunset for your location instead of using the built-in table
+//#define LATITUDE -33.87 //Sydney, south is negative
+//#define LONGITUDE 151.21 //east is positive
+//Render Sweep Settings
+//#define RENDER_SWEEP //uncomment to dump watch faces over serial as PBM frames instead of running the watch
+#define RENDER_SWEEP_BAUD 921600
+#define RENDER_SWEEP_FIRST_DAY 0 //day of year, Jan 1 = 0
+#define RENDER_SWEEP_LAST_DAY 365
+#define RENDER_SWEEP_MINUTE_STEP 60 //1 renders all 1440 minutes of each day
 
 watchySettings settings{
     .cityID = CITY_ID,
@@ -0,0 +1,724 @@
+#include "shopping_list.h"
+#include <stdio.h>
+#include <errno.h>
+#include <LittleFS.h>
+
+#ifdef ESP_PLATFORM
+// LittleFS is also mounted into the ESP32 VFS, so plain stdio works on it
+#define SHOPPING_LIST_ROOT "/littlefs"
+#else
+// Host builds keep the files in the working directory
+#define SHOPPING_LIST_ROOT "."
+#endif
+
+#define SHOPPING_LIST_PATH SHOPPING_LIST_ROOT "/shopping.lst"
+#define SHOPPING_LIST_NEW_PATH SHOPPING_LIST_ROOT "/shopping.new"
+#define SHOPPING_CHECKS_PATH SHOPPING_LIST_ROOT "/shopping.chk"
+#define SHOPPING_CHECKS_NEW_PATH SHOPPING_LIST_ROOT "/shopping.chn"
+#define SHOPPING_LIST_VERSION 2
+// Lists written before the offset index was added; rebuilt when first opened
+#define SHOPPING_LIST_VERSION_UNINDEXED 1
+#define SHOPPING_LIST_HEADER 5
+#define SHOPPING_CHECKS_HEADER 2
+#define SHOPPING_BLOCK_BYTES (SHOPPING_BLOCK_ITEMS / 8)
+#define SHOPPING_BLOCKS (SHOPPING_LIST_MAX_ITEMS / SHOPPING_BLOCK_ITEMS)
+
+// Used until something writes a real list
+const char *defaultShoppingList[] = {
+    //  "---------------"
+        "3 red capsicum",
+        "400g mushroom",
+        "1.5kg chicken",
+        "One pc garlic",
+        "1 pkt salad",
+        "3 tins beans",
+        "500ml Ckn Stock",
+        "3 red capsicum",
+        "400g mushroom",
+        "1.5kg chicken",
+        "One pc garlic",
+        "1 pkt salad",
+        "3 tins beans",
+        "500ml Ckn Stock",
+    };
+
+RTC_DATA_ATTR bool shoppingLoaded = false;
+RTC_DATA_ATTR uint16_t shoppingCount = 0;
+// Checked items in each block of SHOPPING_BLOCK_ITEMS, and in the whole list
+RTC_DATA_ATTR uint16_t shoppingBlockChecked[SHOPPING_BLOCKS];
+RTC_DATA_ATTR uint16_t shoppingChecked;
+// Items toggled since the check marks in flash were written, each one listed once
+RTC_DATA_ATTR uint16_t shoppingPending[SHOPPING_PENDING_TOGGLES];
+RTC_DATA_ATTR uint8_t shoppingPendingCount = 0;
+bool shoppingMounted = false;
+// One block of check marks as they are in flash, without the pending toggles
+uint8_t checkCache[SHOPPING_BLOCK_BYTES];
+uint16_t checkCacheBlock = 0xFFFF;
+// Items [windowStart, windowStart + windowCount) as read from flash
+char shoppingWindow[SHOPPING_WINDOW_ITEMS][SHOPPING_ITEM_MAX_LEN + 1];
+uint16_t windowStart = 0;
+uint16_t windowCount = 0;
+
+bool mountShoppingList() {
+    // RAM state: after a deep sleep the list is still loaded (RTC memory) but not mounted
+    if (!shoppingMounted) {
+        shoppingMounted = LittleFS.begin(true); // format on first use
+    }
+    return shoppingMounted;
+}
+
+bool readUint16(FILE *f, uint16_t &value) {
+    uint8_t bytes[2];
+    if (fread(bytes, 1, 2, f) != 2) {
+        return false;
+    }
+    value = bytes[0] | bytes[1] << 8;
+    return true;
+}
+
+bool readUint32(FILE *f, uint32_t &value) {
+    uint8_t bytes[4];
+    if (fread(bytes, 1, 4, f) != 4) {
+        return false;
+    }
+    value = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+    return true;
+}
+
+void writeUint16(FILE *f, uint16_t value) {
+    fputc(value & 0xFF, f);
+    fputc(value >> 8, f);
+}
+
+void writeUint32(FILE *f, uint32_t value) {
+    writeUint16(f, value & 0xFFFF);
+    writeUint16(f, value >> 16);
+}
+
+uint16_t indexEntries(uint16_t count) {
+    return (count + SHOPPING_INDEX_STRIDE - 1) / SHOPPING_INDEX_STRIDE;
+}
+
+uint16_t checkBytes(uint16_t count) {
+    return (count + 7) / 8;
+}
+
+bool readListHeader(FILE *f, uint8_t &version, uint16_t &count) {
+    uint8_t header[3];
+    if (fread(header, 1, 3, f) != 3 || header[0] != 'S' || header[1] != 'L' || !readUint16(f, count)) {
+        return false;
+    }
+    version = header[2];
+    return true;
+}
+
+void writeListHeader(FILE *f, uint16_t count) {
+    fputc('S', f);
+    fputc('L', f);
+    fputc(SHOPPING_LIST_VERSION, f);
+    writeUint16(f, count);
+}
+
+FILE *openShoppingList(uint16_t &count) {
+    // Opens the list file and leaves it positioned at the offset index
+    FILE *f = fopen(SHOPPING_LIST_PATH, "rb");
+    if (!f) {
+        return nullptr;
+    }
+    uint8_t version;
+    if (!readListHeader(f, version, count) || version != SHOPPING_LIST_VERSION) {
+        fclose(f);
+        return nullptr;
+    }
+    return f;
+}
+
+bool readRecord(FILE *f, char *text, uint8_t &len) {
+    int c = fgetc(f);
+    if (c == EOF || c > SHOPPING_ITEM_MAX_LEN) {
+        return false;
+    }
+    len = c;
+    return fread(text, 1, len, f) == len;
+}
+
+bool migrateShoppingList(uint16_t count) {
+    // Version 1 files have no offset index: one pass over the records to write it, then a
+    // second to copy them after it
+    FILE *old = fopen(SHOPPING_LIST_PATH, "rb");
+    FILE *out = fopen(SHOPPING_LIST_NEW_PATH, "wb");
+    bool ok = old && out && fseek(old, SHOPPING_LIST_HEADER, SEEK_SET) == 0;
+    char text[SHOPPING_ITEM_MAX_LEN];
+    uint8_t len;
+    if (ok) {
+        writeListHeader(out, count);
+    }
+    uint32_t offset = SHOPPING_LIST_HEADER + indexEntries(count) * 4;
+    for (uint16_t i = 0; ok && i < count; i++) {
+        if (i % SHOPPING_INDEX_STRIDE == 0) {
+            writeUint32(out, offset);
+        }
+        ok = readRecord(old, text, len);
+        offset += 1 + len;
+    }
+    ok = ok && fseek(old, SHOPPING_LIST_HEADER, SEEK_SET) == 0;
+    for (uint16_t i = 0; ok && i < count; i++) {
+        ok = readRecord(old, text, len);
+        fputc(len, out);
+        fwrite(text, 1, len, out);
+    }
+    if (old) {
+        fclose(old);
+    }
+    ok = out && fclose(out) == 0 && ok;
+    if (!ok || rename(SHOPPING_LIST_NEW_PATH, SHOPPING_LIST_PATH) != 0) {
+        remove(SHOPPING_LIST_NEW_PATH);
+        return false;
+    }
+    return true;
+}
+
+bool readCheckBlock(FILE *f, uint16_t block, uint8_t *bytes) {
+    // One block of check marks from the check file; bits past the end of the list read as clear
+    memset(bytes, 0, SHOPPING_BLOCK_BYTES);
+    uint16_t items = min(shoppingCount - block * SHOPPING_BLOCK_ITEMS, SHOPPING_BLOCK_ITEMS);
+    size_t length = checkBytes(items);
+    if (fseek(f, SHOPPING_CHECKS_HEADER + block * SHOPPING_BLOCK_BYTES, SEEK_SET) != 0
+            || fread(bytes, 1, length, f) != length) {
+        return false;
+    }
+    if (items % 8) {
+        bytes[items / 8] &= (1 << (items % 8)) - 1;
+    }
+    return true;
+}
+
+const uint8_t *flashChecks(uint16_t block) {
+    // nullptr if the block can't be read. After a deep sleep the list is still loaded from RTC
+    // memory, so this can be the first thing to touch flash.
+    if (block != checkCacheBlock) {
+        checkCacheBlock = 0xFFFF;
+        if (!mountShoppingList()) {
+            return nullptr;
+        }
+        FILE *f = fopen(SHOPPING_CHECKS_PATH, "rb");
+        if (!f) {
+            return nullptr;
+        }
+        bool ok = readCheckBlock(f, block, checkCache);
+        fclose(f);
+        if (!ok) {
+            return nullptr;
+        }
+        checkCacheBlock = block;
+    }
+    return checkCache;
+}
+
+void applyPending(uint16_t block, uint8_t *bytes) {
+    for (uint8_t i = 0; i < shoppingPendingCount; i++) {
+        uint16_t index = shoppingPending[i];
+        if (index / SHOPPING_BLOCK_ITEMS == block) {
+            bytes[index % SHOPPING_BLOCK_ITEMS / 8] ^= 1 << (index % 8);
+        }
+    }
+}
+
+bool countChecks() {
+    // Counts the check marks in flash per block; false if there are none for this list
+    memset(shoppingBlockChecked, 0, sizeof(shoppingBlockChecked));
+    shoppingChecked = 0;
+    shoppingPendingCount = 0;
+    checkCacheBlock = 0xFFFF;
+    FILE *f = fopen(SHOPPING_CHECKS_PATH, "rb");
+    if (!f) {
+        return false;
+    }
+    uint16_t count;
+    bool ok = readUint16(f, count) && count == shoppingCount;
+    uint8_t bytes[SHOPPING_BLOCK_BYTES];
+    for (uint16_t block = 0; ok && block * SHOPPING_BLOCK_ITEMS < shoppingCount; block++) {
+        ok = readCheckBlock(f, block, bytes);
+        for (uint8_t i = 0; i < SHOPPING_BLOCK_BYTES; i++) {
+            shoppingBlockChecked[block] += __builtin_popcount(bytes[i]);
+        }
+        shoppingChecked += shoppingBlockChecked[block];
+    }
+    fclose(f);
+    return ok;
+}
+
+bool writeEmptyChecks() {
+    // Check marks for a new list: none of its items checked
+    memset(shoppingBlockChecked, 0, sizeof(shoppingBlockChecked));
+    shoppingChecked = 0;
+    shoppingPendingCount = 0;
+    checkCacheBlock = 0xFFFF;
+    FILE *f = fopen(SHOPPING_CHECKS_PATH, "wb");
+    if (!f) {
+        return false;
+    }
+    writeUint16(f, shoppingCount);
+    for (uint16_t i = 0; i < checkBytes(shoppingCount); i++) {
+        fputc(0, f);
+    }
+    return fclose(f) == 0;
+}
+
+bool shoppingListBegin() {
+    // After the first load everything needed for navigation is in RTC memory
+    if (shoppingLoaded) {
+        return true;
+    }
+    shoppingCount = 0;
+    windowCount = 0;
+    if (!mountShoppingList()) {
+        return false;
+    }
+    FILE *f = fopen(SHOPPING_LIST_PATH, "rb");
+    if (!f) {
+        // Only a list that was never written is replaced with the sample
+        return errno == ENOENT
+            && shoppingListWrite(defaultShoppingList, sizeof(defaultShoppingList) / sizeof(defaultShoppingList[0]));
+    }
+    uint8_t version;
+    uint16_t count;
+    bool ok = readListHeader(f, version, count) && count <= SHOPPING_LIST_MAX_ITEMS;
+    fclose(f);
+    if (ok && version == SHOPPING_LIST_VERSION_UNINDEXED) {
+        ok = migrateShoppingList(count);
+    } else if (ok && version != SHOPPING_LIST_VERSION) {
+        ok = false;
+    }
+    if (!ok) {
+        return false;
+    }
+    shoppingCount = count;
+    // Check marks saved for a different list are dropped
+    if (!countChecks() && !writeEmptyChecks()) {
+        shoppingCount = 0;
+        return false;
+    }
+    shoppingLoaded = true;
+    return true;
+}
+
+uint16_t shoppingListLength() {
+    return shoppingCount;
+}
+
+void loadWindow(uint16_t first) {
+    // Seek straight to the indexed item at or before first, then read a window of items
+    windowStart = first;
+    windowCount = 0;
+    uint16_t count;
+    if (!mountShoppingList()) {
+        return;
+    }
+    FILE *f = openShoppingList(count);
+    if (!f) {
+        return;
+    }
+    uint32_t offset;
+    fseek(f, (first / SHOPPING_INDEX_STRIDE) * 4, SEEK_CUR);
+    if (readUint32(f, offset) && fseek(f, offset, SEEK_SET) == 0) {
+        uint16_t last = min((uint16_t)(first + SHOPPING_WINDOW_ITEMS), count);
+        char skipped[SHOPPING_ITEM_MAX_LEN];
+        uint8_t len;
+        for (uint16_t i = first - first % SHOPPING_INDEX_STRIDE; i < last; i++) {
+            char *item = i < first ? skipped : shoppingWindow[i - first];
+            if (!readRecord(f, item, len)) {
+                break;
+            }
+            if (i >= first) {
+                item[len] = '\0';
+                windowCount++;
+            }
+        }
+    }
+    fclose(f);
+}
+
+const char *shoppingListItem(uint16_t index) {
+    if (index >= shoppingCount) {
+        return "";
+    }
+    if (index < windowStart || index >= windowStart + windowCount) {
+        // Start the window on a stride boundary so one read covers the whole page
+        loadWindow(index - index % SHOPPING_INDEX_STRIDE);
+        if (index >= windowStart + windowCount) {
+            return "";
+        }
+    }
+    return shoppingWindow[index - windowStart];
+}
+
+int8_t pendingSlot(uint16_t index) {
+    for (uint8_t i = 0; i < shoppingPendingCount; i++) {
+        if (shoppingPending[i] == index) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool readChecked(uint16_t index, bool &checked) {
+    const uint8_t *saved = flashChecks(index / SHOPPING_BLOCK_ITEMS);
+    if (!saved) {
+        return false;
+    }
+    bool flashed = saved[index % SHOPPING_BLOCK_ITEMS / 8] & (1 << (index % 8));
+    checked = flashed != (pendingSlot(index) >= 0);
+    return true;
+}
+
+bool shoppingListChecked(uint16_t index) {
+    bool checked;
+    return index < shoppingCount && readChecked(index, checked) && checked;
+}
+
+void shoppingListToggle(uint16_t index) {
+    // Refused if the mark can't be read: the counts would go the wrong way
+    bool checked;
+    if (index >= shoppingCount || !readChecked(index, checked)) {
+        return;
+    }
+    checked = !checked;
+    int8_t slot = pendingSlot(index);
+    if (slot >= 0) {
+        // Toggled back: flash already has it right
+        shoppingPending[slot] = shoppingPending[--shoppingPendingCount];
+    } else {
+        if (shoppingPendingCount == SHOPPING_PENDING_TOGGLES) {
+            shoppingListFlush();
+            if (shoppingPendingCount == SHOPPING_PENDING_TOGGLES) {
+                return;
+            }
+        }
+        shoppingPending[shoppingPendingCount++] = index;
+    }
+    shoppingBlockChecked[index / SHOPPING_BLOCK_ITEMS] += checked ? 1 : -1;
+    shoppingChecked += checked ? 1 : -1;
+}
+
+uint16_t shoppingListRemaining() {
+    return shoppingCount - shoppingChecked;
+}
+
+uint16_t shoppingListUnchecked(uint16_t n) {
+    if (n >= shoppingListRemaining()) {
+        return shoppingCount;
+    }
+    // Whole blocks from the counts in RTC memory, then whole bytes, then bits. Bits past the
+    // end of the list are clear, but n is below the number of unchecked items so the scan
+    // stops before reaching them.
+    uint16_t block = 0;
+    while (n >= SHOPPING_BLOCK_ITEMS - shoppingBlockChecked[block]) {
+        n -= SHOPPING_BLOCK_ITEMS - shoppingBlockChecked[block];
+        block++;
+    }
+    const uint8_t *saved = flashChecks(block);
+    if (!saved) {
+        return shoppingCount;
+    }
+    uint8_t bytes[SHOPPING_BLOCK_BYTES];
+    memcpy(bytes, saved, sizeof(bytes));
+    applyPending(block, bytes);
+    uint8_t byte = 0;
+    while (n >= 8 - __builtin_popcount(bytes[byte])) {
+        n -= 8 - __builtin_popcount(bytes[byte]);
+        byte++;
+    }
+    uint8_t unchecked = ~bytes[byte];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        if (unchecked & (1 << bit)) {
+            if (n == 0) {
+                return block * SHOPPING_BLOCK_ITEMS + byte * 8 + bit;
+            }
+            n--;
+        }
+    }
+    return shoppingCount;
+}
+
+void shoppingListFlush() {
+    // Toggles pile up in RTC memory; flash is only written once per visit to the list, or
+    // when SHOPPING_PENDING_TOGGLES items have been toggled. The file is rewritten whole and
+    // swapped in, so a reset halfway leaves the old marks.
+    if (shoppingPendingCount == 0 || !mountShoppingList()) {
+        return;
+    }
+    FILE *in = fopen(SHOPPING_CHECKS_PATH, "rb");
+    FILE *out = fopen(SHOPPING_CHECKS_NEW_PATH, "wb");
+    bool ok = in && out;
+    if (ok) {
+        writeUint16(out, shoppingCount);
+    }
+    uint8_t bytes[SHOPPING_BLOCK_BYTES];
+    for (uint16_t block = 0; ok && block * SHOPPING_BLOCK_ITEMS < shoppingCount; block++) {
+        ok = readCheckBlock(in, block, bytes);
+        applyPending(block, bytes);
+        size_t length = min(checkBytes(shoppingCount) - block * SHOPPING_BLOCK_BYTES, SHOPPING_BLOCK_BYTES);
+        ok = ok && fwrite(bytes, 1, length, out) == length;
+    }
+    if (in) {
+        fclose(in);
+    }
+    ok = out && fclose(out) == 0 && ok;
+    if (ok && rename(SHOPPING_CHECKS_NEW_PATH, SHOPPING_CHECKS_PATH) == 0) {
+        shoppingPendingCount = 0;
+    } else {
+        remove(SHOPPING_CHECKS_NEW_PATH);
+    }
+    checkCacheBlock = 0xFFFF;
+}
+
+bool shoppingListWrite(const char *const items[], uint16_t count) {
+    if (!mountShoppingList()) {
+        return false;
+    }
+    count = min(count, (uint16_t)SHOPPING_LIST_MAX_ITEMS);
+    FILE *f = fopen(SHOPPING_LIST_PATH, "wb");
+    if (!f) {
+        return false;
+    }
+    writeListHeader(f, count);
+    uint32_t offset = SHOPPING_LIST_HEADER + indexEntries(count) * 4;
+    for (uint16_t i = 0; i < count; i++) {
+        if (i % SHOPPING_INDEX_STRIDE == 0) {
+            writeUint32(f, offset);
+        }
+        offset += 1 + min(strlen(items[i]), (size_t)SHOPPING_ITEM_MAX_LEN);
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t len = min(strlen(items[i]), (size_t)SHOPPING_ITEM_MAX_LEN);
+        fputc(len, f);
+        fwrite(items[i], 1, len, f);
+    }
+    bool ok = fclose(f) == 0;
+    // A new list starts with nothing checked
+    shoppingCount = count;
+    windowCount = 0;
+    ok = writeEmptyChecks() && ok;
+    shoppingLoaded = ok;
+    return ok;
+}
+
+bool seekRecords(FILE *f, uint16_t count) {
+    return fseek(f, SHOPPING_LIST_HEADER + indexEntries(count) * 4, SEEK_SET) == 0;
+}
+
+FILE *openShoppingRecords(uint16_t &count) {
+    // Opens the list file positioned at the first record
+    FILE *f = openShoppingList(count);
+    if (f && !seekRecords(f, count)) {
+        fclose(f);
+        return nullptr;
+    }
+    return f;
+}
+
+uint32_t shoppingListHash() {
+    uint32_t hash = 2166136261u;
+    uint16_t count;
+    if (!mountShoppingList()) {
+        return hash;
+    }
+    FILE *f = openShoppingRecords(count);
+    if (!f) {
+        return hash;
+    }
+    char text[SHOPPING_ITEM_MAX_LEN];
+    uint8_t len;
+    for (uint16_t i = 0; i < count && readRecord(f, text, len); i++) {
+        for (uint8_t j = 0; j < len; j++) {
+            hash = (hash ^ (uint8_t)text[j]) * 16777619u;
+        }
+        hash = (hash ^ '\n') * 16777619u;
+    }
+    fclose(f);
+    return hash;
+}
+
+struct ScriptLine {
+    char command;
+    const char *arg;
+    size_t argLength;
+};
+
+bool nextScriptLine(const char *&script, const char *end, ScriptLine &line) {
+    // Splits off one "<command> <arg>" line; blank lines are skipped
+    while (script < end && (*script == '\n' || *script == '\r')) {
+        script++;
+    }
+    if (script >= end) {
+        return false;
+    }
+    const char *eol = (const char *)memchr(script, '\n', end - script);
+    if (!eol) {
+        eol = end;
+    }
+    const char *lineEnd = eol > script && eol[-1] == '\r' ? eol - 1 : eol;
+    line.command = script[0];
+    line.arg = script + 1;
+    if (line.arg < lineEnd && *line.arg == ' ') {
+        line.arg++;
+    }
+    line.argLength = lineEnd > line.arg ? lineEnd - line.arg : 0;
+    script = eol;
+    return true;
+}
+
+bool parseCount(const ScriptLine &line, uint32_t &value) {
+    if (line.argLength == 0 || line.argLength > 5) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = 0; i < line.argLength; i++) {
+        if (line.arg[i] < '0' || line.arg[i] > '9') {
+            return false;
+        }
+        value = value * 10 + (line.arg[i] - '0');
+    }
+    return true;
+}
+
+// What one walk through an edit script does
+enum ScriptPass {
+    SCRIPT_CHECK,  // check the script and count the new items
+    SCRIPT_INDEX,  // write the offset index of the new list
+    SCRIPT_RECORDS // write its records and check marks
+};
+
+ShoppingSyncResult runScript(const char *script, size_t length, FILE *old, uint16_t oldCount, ScriptPass pass,
+                             FILE *out, FILE *checksOut, uint32_t recordsStart, uint16_t &newCount) {
+    // Walks the script once, reading the old records it keeps or drops from old. Kept items
+    // keep their check marks.
+    const char *end = script + length;
+    uint32_t offset = recordsStart;
+    uint16_t oldIndex = 0;
+    uint8_t checks = 0;
+    newCount = 0;
+    char text[SHOPPING_ITEM_MAX_LEN];
+    uint8_t len = 0;
+    ScriptLine line;
+    if (!nextScriptLine(script, end, line) || line.command != 'b') {
+        return SYNC_BAD_SCRIPT;
+    }
+    while (nextScriptLine(script, end, line)) {
+        uint32_t n = 1;
+        if ((line.command == '=' || line.command == '-') && (!parseCount(line, n) || oldIndex + n > oldCount)) {
+            return SYNC_BAD_SCRIPT;
+        }
+        if (line.command == '+') {
+            if (line.argLength > SHOPPING_ITEM_MAX_LEN) {
+                return SYNC_BAD_SCRIPT;
+            }
+            len = line.argLength;
+            memcpy(text, line.arg, len);
+        } else if (line.command != '=' && line.command != '-') {
+            return SYNC_BAD_SCRIPT;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            bool kept = line.command == '=';
+            if (line.command != '+') {
+                if (!readRecord(old, text, len)) {
+                    return SYNC_IO_ERROR;
+                }
+                oldIndex++;
+            }
+            if (line.command == '-') {
+                continue;
+            }
+            if (newCount == SHOPPING_LIST_MAX_ITEMS) {
+                return SYNC_BAD_SCRIPT;
+            }
+            if (pass == SCRIPT_INDEX && newCount % SHOPPING_INDEX_STRIDE == 0) {
+                writeUint32(out, offset);
+            }
+            if (pass == SCRIPT_RECORDS) {
+                fputc(len, out);
+                fwrite(text, 1, len, out);
+                if (kept && shoppingListChecked(oldIndex - 1)) {
+                    checks |= 1 << (newCount % 8);
+                }
+                if (newCount % 8 == 7) {
+                    fputc(checks, checksOut);
+                    checks = 0;
+                }
+            }
+            offset += 1 + len;
+            newCount++;
+        }
+    }
+    if (pass == SCRIPT_RECORDS && newCount % 8) {
+        fputc(checks, checksOut);
+    }
+    return SYNC_OK;
+}
+
+ShoppingSyncResult shoppingListApply(const char *script, size_t length) {
+    if (!shoppingListBegin()) {
+        return SYNC_IO_ERROR;
+    }
+    const char *end = script + length;
+    ScriptLine line;
+    const char *cursor = script;
+    if (!nextScriptLine(cursor, end, line) || line.command != 'b' || line.argLength < 6
+            || strncmp(line.arg, "ase ", 4) != 0) {
+        return SYNC_BAD_SCRIPT;
+    }
+    char base[9] = {};
+    memcpy(base, line.arg + 4, min(line.argLength - 4, (size_t)8));
+    if (strtoul(base, nullptr, 16) != shoppingListHash()) {
+        return SYNC_STALE;
+    }
+
+    // Three passes over the old list (check, index, records) keep memory use independent
+    // of its length. The new files are only swapped in once complete.
+    uint16_t oldCount, newCount;
+    FILE *old = openShoppingRecords(oldCount);
+    FILE *out = nullptr;
+    FILE *checksOut = nullptr;
+    ShoppingSyncResult result = old ? runScript(script, length, old, oldCount, SCRIPT_CHECK, nullptr, nullptr, 0, newCount)
+                                    : SYNC_IO_ERROR;
+    if (result == SYNC_OK) {
+        out = fopen(SHOPPING_LIST_NEW_PATH, "wb");
+        checksOut = fopen(SHOPPING_CHECKS_NEW_PATH, "wb");
+        result = out && checksOut ? SYNC_OK : SYNC_IO_ERROR;
+    }
+    if (result == SYNC_OK) {
+        writeListHeader(out, newCount);
+        writeUint16(checksOut, newCount);
+        const uint32_t recordsStart = SHOPPING_LIST_HEADER + indexEntries(newCount) * 4;
+        for (uint8_t pass = SCRIPT_INDEX; pass <= SCRIPT_RECORDS && result == SYNC_OK; pass++) {
+            result = seekRecords(old, oldCount)
+                ? runScript(script, length, old, oldCount, (ScriptPass)pass, out, checksOut, recordsStart, newCount)
+                : SYNC_IO_ERROR;
+        }
+    }
+    if (old) {
+        fclose(old);
+    }
+    if (out && fclose(out) != 0 && result == SYNC_OK) {
+        result = SYNC_IO_ERROR;
+    }
+    if (checksOut && fclose(checksOut) != 0 && result == SYNC_OK) {
+        result = SYNC_IO_ERROR;
+    }
+    // The list goes first; marks that don't follow it no longer match and are dropped on the next load
+    if (result == SYNC_OK && rename(SHOPPING_LIST_NEW_PATH, SHOPPING_LIST_PATH) != 0) {
+        result = SYNC_IO_ERROR;
+    }
+    if (result == SYNC_OK) {
+        shoppingCount = newCount;
+        windowCount = 0;
+        if (rename(SHOPPING_CHECKS_NEW_PATH, SHOPPING_CHECKS_PATH) != 0 || !countChecks()) {
+            shoppingLoaded = false;
+            result = SYNC_IO_ERROR;
+        }
+    }
+    remove(SHOPPING_LIST_NEW_PATH);
+    remove(SHOPPING_CHECKS_NEW_PATH);
+    return result;
+}
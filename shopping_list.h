@@ -0,0 +1,63 @@
+#ifndef SHOPPING_LIST_H
+#define SHOPPING_LIST_H
+
+#include <Arduino.h>
+
+#ifndef RTC_DATA_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+// Check marks live in flash. RTC memory keeps a checked count per block of SHOPPING_BLOCK_ITEMS
+// (128 bytes at this size), which bounds the list, and the toggles not written back yet.
+#define SHOPPING_LIST_MAX_ITEMS 16384
+// Longer items are cut when the list is written; the screen fits about 18 characters
+#define SHOPPING_ITEM_MAX_LEN 31
+// Every this many items the list file records where the item starts
+#define SHOPPING_INDEX_STRIDE 8
+// Checked items are counted per block, so finding the n-th unchecked one is a short scan
+#define SHOPPING_BLOCK_ITEMS 256
+// Items read from flash at a time; two strides always cover a page of MENU_LENGTH rows
+#define SHOPPING_WINDOW_ITEMS (2 * SHOPPING_INDEX_STRIDE)
+// Toggles held in RTC memory before they are written to flash early
+#define SHOPPING_PENDING_TOGGLES 32
+
+// The shopping list lives in flash (LittleFS) as two files:
+//   shopping.lst  "SL", version byte, uint16 item count,
+//                 uint32 file offset of every SHOPPING_INDEX_STRIDE-th item,
+//                 then per item a length byte and the text
+//                 (version 1 had no offsets and is rebuilt with them when first opened)
+//   shopping.chk  uint16 item count, then the check marks as a bitset, item 0 in bit 0 of byte 0
+// Toggles are kept in RTC memory and only written back by shoppingListFlush(), or once
+// SHOPPING_PENDING_TOGGLES have piled up. Items and check marks are read from flash a window
+// at a time, so memory use doesn't depend on the list length.
+// The sample list is written if there is no list yet; false if the list can't be read.
+bool shoppingListBegin();
+uint16_t shoppingListLength();
+const char *shoppingListItem(uint16_t index);
+bool shoppingListChecked(uint16_t index);
+void shoppingListToggle(uint16_t index);
+uint16_t shoppingListRemaining();
+// Index of the n-th unchecked item, or the list length if there are not that many
+uint16_t shoppingListUnchecked(uint16_t n);
+void shoppingListFlush();
+bool shoppingListWrite(const char *const items[], uint16_t count);
+
+enum ShoppingSyncResult {
+    SYNC_OK,
+    SYNC_BAD_SCRIPT, // unknown command, bad number, item too long or list too long
+    SYNC_STALE,      // script was made against a different list
+    SYNC_IO_ERROR
+};
+
+// FNV-1a over every item followed by '\n'; a sync client sends it back to say which list it diffed
+uint32_t shoppingListHash();
+// Edits the list with a line-delimited script:
+//   base <hash>  hash of the list the script was made against, in hex (first line)
+//   = <n>        keep the next n items, check marks and all
+//   - <n>        drop the next n items
+//   + <text>     insert an unchecked item
+// Old items the script doesn't reach are dropped, so a full upload is just "+" lines.
+// The whole script is checked before anything is written.
+ShoppingSyncResult shoppingListApply(const char *script, size_t length);
+
+#endif
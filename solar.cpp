@@ -0,0 +1,107 @@
+#include "solar.h"
+#include "lookups.h"
+
+// Radius of the ring the arc meets at sunrise/sunset, fitted to the baked-in table
+#define DAY_NIGHT_RING_RADIUS 99.0f
+// Nearly straight arcs (around the equinoxes) are capped so centre fits an int16
+#define DAY_NIGHT_MAX_OFFSET 22000
+#define DEG_TO_RAD_F 0.017453292f
+#define MINUTES_PER_DEGREE 4.0f
+// Row of Feb 29 in the leap-year day tables
+#define LEAP_DAY_ROW 59
+
+DayNight lookupDayNight(uint16_t day) {
+    DayNight dayNight;
+    dayNight.centre = dayNightCentre(day);
+    dayNight.radius = dayNightRadius(day);
+    dayNight.sunrise = dayNightSunrise(day);
+    dayNight.sunset = dayNightSunset(day);
+    return dayNight;
+}
+
+// Whole days from J2000.0 (noon UT, 1 Jan 2000) to noon UT on the given day of the year (0-based)
+static int32_t daysSinceJ2000(uint16_t year, uint16_t dayOfYear) {
+    const int32_t before = year - 1;
+    const int32_t leapDays = (before / 4 - before / 100 + before / 400) - (1999 / 4 - 1999 / 100 + 1999 / 400);
+    return 365 * ((int32_t)year - 2000) + leapDays + dayOfYear;
+}
+
+struct SunPosition {
+    float declination;    // radians
+    float equationOfTime; // minutes
+};
+
+// Sun position from the Meeus series the NOAA solar calculator uses
+// https://gml.noaa.gov/grad/solcalc/calcdetails.html
+// Time is in days from J2000 rather than centuries so a float keeps a step of minutes.
+static SunPosition sunPosition(float days) {
+    const float centuries = days / 36525.0f;
+    const float meanLongitude = fmodf(280.46646f + 0.98564736f * days, 360.0f) * DEG_TO_RAD_F;
+    const float meanAnomaly = fmodf(357.52911f + 0.98560028f * days, 360.0f) * DEG_TO_RAD_F;
+    const float eccentricity = 0.016708634f - 0.000042037f * centuries;
+    const float centre = 1.914602f * sinf(meanAnomaly) + 0.019993f * sinf(2 * meanAnomaly)
+                         + 0.000289f * sinf(3 * meanAnomaly);
+    const float node = fmodf(125.04f - 0.05295377f * days, 360.0f) * DEG_TO_RAD_F;
+    const float apparentLongitude = meanLongitude + (centre - 0.00569f - 0.00478f * sinf(node)) * DEG_TO_RAD_F;
+    const float obliquity = (23.439291f - 0.0130042f * centuries + 0.00256f * cosf(node)) * DEG_TO_RAD_F;
+    const float y = tanf(obliquity / 2) * tanf(obliquity / 2);
+    SunPosition position;
+    position.declination = asinf(sinf(obliquity) * sinf(apparentLongitude));
+    position.equationOfTime = MINUTES_PER_DEGREE / DEG_TO_RAD_F
+                              * (y * sinf(2 * meanLongitude) - 2 * eccentricity * sinf(meanAnomaly)
+                                 + 4 * eccentricity * y * sinf(meanAnomaly) * cosf(2 * meanLongitude)
+                                 - 0.5f * y * y * sinf(4 * meanLongitude)
+                                 - 1.25f * eccentricity * eccentricity * sinf(2 * meanAnomaly));
+    return position;
+}
+
+// Minutes from solar noon to sunrise or sunset: 0 in polar night, DAY_NIGHT_NOON for midnight sun
+static float halfDayMinutes(float latitude, float declination) {
+    // 90.833 degrees allows for refraction and the size of the sun's disc
+    float cosHourAngle = cosf(90.833f * DEG_TO_RAD_F) / (cosf(latitude) * cosf(declination))
+                         - tanf(latitude) * tanf(declination);
+    cosHourAngle = constrain(cosHourAngle, -1.0f, 1.0f);
+    return acosf(cosHourAngle) / DEG_TO_RAD_F * MINUTES_PER_DEGREE;
+}
+
+DayNight solveDayNight(uint16_t day, uint16_t year, float latitude, float longitude, int32_t gmtOffset) {
+    // Runs once a day, so this sticks to single-precision float, which the ESP32 does in hardware.
+    // (The shorter Fourier fit in NOAA's solareqns.PDF lags today's equinoxes by most of a day.)
+    // Rows after Feb 29 are a day ahead in other years
+    const bool leapYear = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+    const uint16_t dayOfYear = !leapYear && day > LEAP_DAY_ROW ? day - 1 : day;
+    const float noonDays = daysSinceJ2000(year, dayOfYear) - longitude / 360.0f;
+    const float lat = latitude * DEG_TO_RAD_F;
+    const float halfDay = halfDayMinutes(lat, sunPosition(noonDays).declination);
+
+    // Sunrise and sunset again with the sun where it is at those times, which matters at high
+    // latitudes where the day length changes quickly
+    const float localNoon = DAY_NIGHT_NOON - MINUTES_PER_DEGREE * longitude + gmtOffset / 60.0f;
+    const SunPosition rise = sunPosition(noonDays - halfDay / (2 * DAY_NIGHT_NOON));
+    const SunPosition set = sunPosition(noonDays + halfDay / (2 * DAY_NIGHT_NOON));
+    const float riseHalfDay = halfDayMinutes(lat, rise.declination);
+    const float setHalfDay = halfDayMinutes(lat, set.declination);
+    DayNight dayNight;
+    dayNight.sunrise = constrain(lroundf(localNoon - rise.equationOfTime - riseHalfDay), 0L, 1439L);
+    dayNight.sunset = constrain(lroundf(localNoon - set.equationOfTime + setHalfDay), 0L, 1440L);
+    if (halfDay == 0) {
+        // Polar night
+        dayNight.sunset = dayNight.sunrise;
+    } else if (halfDay >= DAY_NIGHT_NOON) {
+        // Midnight sun: daytime all day, whatever the time zone
+        dayNight.sunrise = 0;
+        dayNight.sunset = 2 * DAY_NIGHT_NOON;
+    }
+
+    // The arc on the face is symmetric about noon, so it is built from the day length only:
+    // a circle through the display centre and the ring at +/- halfDay from noon
+    const float sunriseAngle = (DAY_NIGHT_NOON / 2 - halfDay) / (2 * DAY_NIGHT_NOON) * TWO_PI;
+    const float sine = sinf(sunriseAngle);
+    float offset = DAY_NIGHT_MAX_OFFSET;
+    if (fabsf(sine) * 2 * DAY_NIGHT_MAX_OFFSET > DAY_NIGHT_RING_RADIUS) {
+        offset = -DAY_NIGHT_RING_RADIUS / (2 * sine);
+    }
+    dayNight.centre = DAY_NIGHT_AXIS + (int16_t)offset;
+    dayNight.radius = abs(dayNight.centre - DAY_NIGHT_AXIS);
+    return dayNight;
+}
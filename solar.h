@@ -0,0 +1,27 @@
+#ifndef SOLAR_H
+#define SOLAR_H
+
+#include <Arduino.h>
+
+#ifndef RTC_DATA_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+// Everything drawDayNight and drawSun need for one day.
+// centre/radius describe the day/night arc (see lookups.h), sunrise/sunset are minutes past midnight.
+struct DayNight {
+    int16_t centre;
+    int16_t radius;
+    uint16_t sunrise;
+    uint16_t sunset;
+};
+
+// Day/night for a row of the leap-year day tables (0 = Jan 1), from the baked-in table
+DayNight lookupDayNight(uint16_t day);
+
+// Same, solved for any location with the NOAA solar calculator equations. year is the
+// calendar year, to tell which rows are real days. Latitude/longitude in degrees (north/east
+// positive), gmtOffset in seconds.
+DayNight solveDayNight(uint16_t day, uint16_t year, float latitude, float longitude, int32_t gmtOffset);
+
+#endif
@@ -0,0 +1,30 @@
+#include "static_layer.h"
+
+RTC_DATA_ATTR uint8_t staticLayer[STATIC_LAYER_SIZE];
+RTC_DATA_ATTR uint32_t staticLayerKey;
+RTC_DATA_ATTR bool staticLayerValid = false;
+
+bool staticLayerRestore(FrameBuffer &frame, uint32_t key) {
+    if (!staticLayerValid || key != staticLayerKey || frame.bufferSize() != STATIC_LAYER_SIZE) {
+        return false;
+    }
+    memcpy(frame.getBuffer(), staticLayer, STATIC_LAYER_SIZE);
+    return true;
+}
+
+void staticLayerSave(const FrameBuffer &frame, uint32_t key) {
+    if (frame.bufferSize() != STATIC_LAYER_SIZE) {
+        return;
+    }
+    memcpy(staticLayer, frame.getBuffer(), STATIC_LAYER_SIZE);
+    staticLayerKey = key;
+    staticLayerValid = true;
+}
+
+void staticLayerInvert(uint32_t keyBits) {
+    if (!staticLayerValid) {
+        return;
+    }
+    rasterOp(staticLayer, NULL, STATIC_LAYER_SIZE, ROP_XOR);
+    staticLayerKey ^= keyBits;
+}
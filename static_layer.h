@@ -0,0 +1,21 @@
+#ifndef STATIC_LAYER_H
+#define STATIC_LAYER_H
+
+#include "frame_buffer.h"
+
+#ifndef RTC_DATA_ATTR
+#define RTC_DATA_ATTR
+#endif
+
+// One 200x200 1bpp frame. Lives in RTC slow memory (8KB total), so keep other RTC data small.
+#define STATIC_LAYER_SIZE 5000
+
+// Cache of the parts of the face that only change once a day or on a mode toggle
+// (background, day/night arc, masks). Survives deep sleep, so a minute tick restores it
+// with one memcpy instead of redrawing.
+bool staticLayerRestore(FrameBuffer &frame, uint32_t key);
+void staticLayerSave(const FrameBuffer &frame, uint32_t key);
+// Swap black and white in the cached layer and flip keyBits in its key, for a colour toggle
+void staticLayerInvert(uint32_t keyBits);
+
+#endif
@@ -0,0 +1,27 @@
+#include "text_measure.h"
+
+Rect measureText(const GFXfont *font, const char *str) {
+    GFXfont f;
+    memcpy_P(&f, font, sizeof(GFXfont));
+    // Same starting box as getTextBounds, which always reaches the baseline and the origin
+    int16_t minX = INT16_MAX, maxX = -1, minY = INT16_MAX, maxY = -1;
+    int16_t cursor = 0;
+    for (; *str; str++) {
+        uint8_t c = *str;
+        if (c < f.first || c > f.last) {
+            continue; // getTextBounds skips these too
+        }
+        GFXglyph g;
+        memcpy_P(&g, &f.glyph[c - f.first], sizeof(GFXglyph));
+        // Empty glyphs (spaces) count as well, as they do in getTextBounds
+        minX = min(minX, (int16_t)(cursor + g.xOffset));
+        maxX = max(maxX, (int16_t)(cursor + g.xOffset + g.width - 1));
+        minY = min(minY, (int16_t)g.yOffset);
+        maxY = max(maxY, (int16_t)(g.yOffset + g.height - 1));
+        cursor += g.xAdvance;
+    }
+    if (maxX < minX || maxY < minY) {
+        return Rect{0, 0, 0, 0};
+    }
+    return Rect{minX, minY, (int16_t)(maxX - minX + 1), (int16_t)(maxY - minY + 1)};
+}
@@ -0,0 +1,11 @@
+#ifndef TEXT_MEASURE_H
+#define TEXT_MEASURE_H
+
+#include <Adafruit_GFX.h>
+#include "dirty_region.h"
+
+// Bounding box of one line of text set in font with the cursor at 0,0, the same box
+// getTextBounds gives, but read straight from the glyph metrics: no wrapping, no bitmaps.
+Rect measureText(const GFXfont *font, const char *str);
+
+#endif
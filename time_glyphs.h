@@ -0,0 +1,231 @@
+#ifndef TIME_GLYPHS_H
+#define TIME_GLYPHS_H
+
+// Generated by tools/glyph_cache.py from MADE_Sunflower_PERSONAL_USE39pt7b, do not edit.
+// Glyphs for "0123456789:" with each row padded to a whole byte
+
+#define TIME_GLYPH_FIRST '0'
+#define TIME_GLYPH_COUNT 11
+
+struct TimeGlyph {
+    uint16_t offset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+};
+
+const TimeGlyph timeGlyphs[TIME_GLYPH_COUNT] PROGMEM = {
+    {    0,  43,  55,  43,   0,  -53}, // '0'
+    {  330,  26,  53,  30,   2,  -52}, // '1'
+    {  542,  38,  54,  41,   2,  -53}, // '2'
+    {  812,  41,  54,  41,  -1,  -52}, // '3'
+    { 1136,  44,  53,  44,  -1,  -52}, // '4'
+    { 1454,  42,  58,  40,  -1,  -56}, // '5'
+    { 1802,  41,  54,  41,   0,  -52}, // '6'
+    { 2126,  38,  54,  40,   1,  -52}, // '7'
+    { 2396,  42,  55,  42,   0,  -53}, // '8'
+    { 2726,  41,  53,  41,   0,  -52}, // '9'
+    { 3044,  16,  36,  20,   2,  -34}, // ':'
+};
+
+const uint8_t timeGlyphBitmaps[3116] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x1F, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0xFE,
+    0x01, 0xFF, 0xE0, 0x00, 0x01, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xF8, 0x00,
+    0x07, 0xFC, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x3F,
+    0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xF8,
+    0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x80,
+    0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x0F,
+    0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xF0,
+    0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0,
+    0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x03,
+    0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8,
+    0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0,
+    0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFC, 0x00, 0x03,
+    0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFC,
+    0x00, 0x03, 0xFF, 0xC0, 0x7F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0x80,
+    0x3F, 0xFE, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x03,
+    0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x07, 0xFF,
+    0x80, 0x07, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x03, 0xFF, 0xC0, 0x0F, 0xF8, 0x00,
+    0x01, 0xFF, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xF8, 0x3F,
+    0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03,
+    0xE0, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+    0xE0, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+    0xE0, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x03, 0xFF,
+    0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
+    0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x07,
+    0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFE, 0x0F,
+    0xFF, 0x00, 0x07, 0xF8, 0x03, 0xFF, 0x80, 0x0F, 0xF0, 0x01, 0xFF, 0xC0, 0x1F, 0xE0, 0x01, 0xFF,
+    0xE0, 0x1F, 0xE0, 0x00, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0xF0, 0x3F, 0xC0, 0x00, 0xFF, 0xF8,
+    0x7F, 0xC0, 0x00, 0xFF, 0xF8, 0x7F, 0xC0, 0x00, 0xFF, 0xF8, 0x7F, 0xE0, 0x00, 0xFF, 0xF8, 0x7F,
+    0xE0, 0x00, 0xFF, 0xF8, 0x7F, 0xF0, 0x00, 0xFF, 0xF8, 0x7F, 0xFF, 0x01, 0xFF, 0xF8, 0x7F, 0xFF,
+    0x01, 0xFF, 0xF8, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x3F, 0xFE, 0x03, 0xFF, 0xF8, 0x1F, 0xFC, 0x03,
+    0xFF, 0xF0, 0x0F, 0xF8, 0x07, 0xFF, 0xF0, 0x07, 0xE0, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF,
+    0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0x00,
+    0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00,
+    0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x3F,
+    0xF0, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00,
+    0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x18, 0x07, 0xE0, 0x00, 0x00, 0x18, 0x0F, 0x80, 0x00, 0x00,
+    0x38, 0x1F, 0x00, 0x00, 0x00, 0x38, 0x1E, 0x00, 0x00, 0x00, 0x78, 0x3E, 0x00, 0x00, 0x00, 0xF8,
+    0x3C, 0x00, 0x00, 0x03, 0xF8, 0x38, 0x00, 0x00, 0x1F, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x3E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x1F,
+    0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE,
+    0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x80,
+    0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x0F,
+    0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xC0,
+    0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFE, 0x00,
+    0x1F, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x7F,
+    0xF0, 0x00, 0x03, 0xFC, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x79, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xF1, 0xFF, 0xF0, 0x00,
+    0x00, 0x01, 0xE1, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xC1, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xC1, 0xFF,
+    0xF0, 0x00, 0x00, 0x0F, 0x81, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x1F,
+    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3E, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x3C, 0x01, 0xFF, 0xF0, 0x00,
+    0x00, 0x78, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xF8, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x01, 0xFF,
+    0xF0, 0x00, 0x01, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xE0, 0x01, 0xFF, 0xF0, 0x00, 0x03, 0xC0,
+    0x01, 0xFF, 0xF0, 0x00, 0x07, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xFF, 0xF0, 0x00,
+    0x1F, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1E, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x3E, 0x00, 0x01, 0xFF,
+    0xF0, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x83, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+    0x03, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x0F, 0xF8, 0x00, 0x0F,
+    0xFF, 0x80, 0x1F, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x3F, 0xFF,
+    0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0x80,
+    0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0x80, 0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
+    0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0x1F, 0xFE, 0x00, 0x3F, 0xE0,
+    0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xF8, 0x00,
+    0x0F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFC, 0x01, 0xFF,
+    0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF,
+    0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x0F, 0xE0,
+    0x00, 0x00, 0x3F, 0xFE, 0x7F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xF8, 0x00,
+    0x7F, 0xFE, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x7F,
+    0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xF8,
+    0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x1F,
+    0xFF, 0x00, 0x7F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFC,
+    0x00, 0x0F, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
+    0x3F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x0F,
+    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x07, 0xFF,
+    0x00, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0x80, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xC0, 0x1F, 0xE0, 0x00,
+    0x00, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0x00, 0x3F, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x7C, 0x00, 0x00, 0x01, 0xC0, 0x70, 0x00, 0x00, 0x03, 0x80, 0x60, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
+    0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x03,
+    0xFC, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+    0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0x01, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x03,
+    0xFF, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF,
+    0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x80,
+    0x00, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00,
+    0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00,
+    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+    0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFE,
+    0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F,
+    0xC1, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x00,
+    0x07, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F,
+    0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFE,
+    0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFE, 0x00,
+    0x1F, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x07,
+    0xFE, 0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x07, 0xFC, 0x00, 0x0F, 0xFF,
+    0xF0, 0x0F, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0x0F, 0xF8, 0x00, 0x07, 0xFF, 0xFE, 0x0F, 0xF0, 0x00,
+    0x03, 0xFF, 0xFF, 0x9F, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x00,
+    0x01, 0xFE, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x07, 0xF8, 0x1F, 0xFF,
+    0xFF, 0x00, 0x1F, 0xF8, 0x07, 0xFF, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFF, 0xFF, 0x80, 0x3F, 0xF0,
+    0x00, 0xFF, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x7F, 0xFF, 0xC0, 0x7F, 0xE0, 0x00, 0x3F, 0xFF, 0xC0,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F,
+    0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xE0,
+    0x00, 0x07, 0xFF, 0xC0, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0x80,
+    0x7F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x0F,
+    0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x01, 0xFF,
+    0x80, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x7F, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xFF, 0x00, 0x00, 0x03, 0xFC,
+    0x03, 0xFF, 0x80, 0x00, 0x07, 0xF8, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xF8, 0x00, 0xFF, 0xE0, 0x00,
+    0x1F, 0xF8, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x7F,
+    0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xF0,
+    0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00,
+    0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F,
+    0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFC,
+    0x00, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0x1F, 0xFF, 0x80,
+    0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x1F,
+    0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x00, 0x1F, 0xFF,
+    0xC0, 0x7F, 0xFF, 0x00, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x3F, 0xFE, 0x00, 0x00, 0x0F, 0xFC, 0x3F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00,
+    0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF,
+    0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xFC,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F, 0xF0, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0xF0, 0x3F, 0xFC, 0x7F, 0xFE, 0x7F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x7F, 0xFE, 0x7F, 0xFE, 0x3F, 0xFC, 0x0F, 0xF0, 0x00, 0x00,
+};
+
+#endif
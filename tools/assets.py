@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Keep assets.h, the one header holding the sketch's bitmaps, free of duplicates.
+
+Every bitmap is content-hashed (size + bits) and emitted once, under the first name it was
+seen with; a new export that repeats an existing bitmap is reported and dropped, so use the
+existing name. PNGs are hashed too and listed in the manifest, which shows whether the
+artwork in bitmaps/ still matches what is in assets.h. To add image2cpp exports:
+
+    python3 tools/assets.py assets.h new_icons.h --png bitmaps/*.png
+
+This rewrites assets.h and bitmaps/assets_manifest.txt.
+
+Duplicates only cost flash when both copies are referenced: const arrays have internal
+linkage, so the compiler drops every bitmap the sketch doesn't use.
+"""
+import argparse
+import hashlib
+import os
+import re
+import sys
+
+from packbits import pack_rows, read_png
+
+ARRAY_RE = re.compile(r"//\s*'([^']*)',\s*(\d+)x(\d+)px[^\n]*\n"
+                      r"const unsigned char\s+(\w+)\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", re.S)
+
+
+def read_header(path):
+    src = open(path).read()
+    for match in ARRAY_RE.finditer(src):
+        width, height, name = int(match.group(2)), int(match.group(3)), match.group(4)
+        data = bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]{2}', match.group(5)))
+        if len(data) != (width + 7) // 8 * height:
+            sys.exit('%s: %s is %d bytes, expected %dx%d' % (path, name, len(data), width, height))
+        yield name, width, height, data
+
+
+def content_hash(width, height, data):
+    return hashlib.sha1(b'%dx%d:' % (width, height) + data).hexdigest()[:12]
+
+
+def format_array(name, width, height, data):
+    lines = ["// '%s', %dx%dpx" % (name, width, height)]
+    lines.append('const unsigned char %s [] PROGMEM = {' % name)
+    for i in range(0, len(data), 16):
+        lines.append('\t' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ', ')
+    lines[-1] = lines[-1].rstrip(', ')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('headers', nargs='+', help='image2cpp headers to merge')
+    parser.add_argument('--png', nargs='*', default=[], help='PNG artwork to hash into the manifest')
+    parser.add_argument('--threshold', type=int, default=128, help='brightness at which a PNG pixel is set')
+    parser.add_argument('--out', default='assets.h')
+    parser.add_argument('--manifest', default='bitmaps/assets_manifest.txt')
+    args = parser.parse_args()
+
+    assets = {}  # hash -> [name, width, height, data]
+    order = []
+    names = set()
+    for path in args.headers:
+        for name, width, height, data in read_header(path):
+            key = content_hash(width, height, data)
+            if key in assets:
+                print('%s:%s is the same bitmap as %s, dropped' % (path, name, assets[key][0]))
+                continue
+            if name in names:
+                sys.exit('%s:%s: a different bitmap already has this name' % (path, name))
+            assets[key] = [name, width, height, data]
+            names.add(name)
+            order.append(key)
+    total = sum(len(assets[key][3]) for key in order)
+
+    with open(args.out, 'w') as out:
+        out.write('#ifndef ASSETS_H\n#define ASSETS_H\n\n')
+        out.write('// Every bitmap once, kept free of duplicates by tools/assets.py. %d bitmaps, %d bytes;\n'
+                  '// only the ones the sketch draws end up in flash.\n\n' % (len(order), total))
+        out.write('\n'.join(format_array(*assets[key]) for key in order))
+        out.write('\n\n#endif\n')
+
+    with open(args.manifest, 'w') as manifest:
+        manifest.write('# hash size bytes name\n')
+        for key in order:
+            name, width, height, data = assets[key]
+            manifest.write('%s %dx%d %d %s\n' % (key, width, height, len(data), name))
+        for path in args.png:
+            width, height, pixels = read_png(path, args.threshold)
+            key = content_hash(width, height, pack_rows(width, height, pixels))
+            status = 'matches ' + assets[key][0] if key in assets else 'not in assets.h'
+            manifest.write('%s %dx%d - %s (%s)\n' % (key, width, height, os.path.basename(path), status))
+
+    print('%d bitmaps, %d bytes' % (len(order), total))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,49 @@
+"""Read Adafruit GFX font headers (fontconvert / oleddisplay.squix.ch output).
+
+Used by glyph_cache.py.
+"""
+import re
+
+COMMENT = re.compile(r'//[^\n]*|/\*.*?\*/', re.S)
+
+
+def read_font(path):
+    """Return dict(name, bitmaps, glyphs, first, last, y_advance) for the GFXfont in path.
+
+    glyphs is a list of (offset, width, height, x_advance, x_offset, y_offset), one per
+    character from first to last.
+    """
+    with open(path) as f:
+        text = COMMENT.sub('', f.read())
+    bitmaps = re.search(r'(\w+)Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    glyphs = re.search(r'\w+Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    font = re.search(r'GFXfont\s+(\w+)\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S)
+    if not (bitmaps and glyphs and font):
+        raise ValueError('%s: no GFXfont found' % path)
+    tail = [int(v, 0) for v in font.group(2).split(',')[-3:]]
+    return {
+        'name': font.group(1),
+        'bitmaps': bytes(int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', bitmaps.group(2))),
+        'glyphs': [tuple(int(v) for v in g.split(','))
+                   for g in re.findall(r'\{([-\d,\s]+)\}', glyphs.group(1))],
+        'first': tail[0],
+        'last': tail[1],
+        'y_advance': tail[2],
+    }
+
+
+def glyph_rows(font, char):
+    """Pixel rows of a glyph as lists of 0/1, unpacked from the bit-stream GFX format."""
+    offset, width, height = font['glyphs'][ord(char) - font['first']][:3]
+    bits = []
+    for byte in font['bitmaps'][offset:offset + (width * height + 7) // 8]:
+        bits += [(byte >> (7 - i)) & 1 for i in range(8)]
+    return [bits[y * width:(y + 1) * width] for y in range(height)]
+
+
+def pack_rows(rows):
+    """Pixel rows to the GFX bit stream (rows run on without padding)."""
+    bits = [bit for row in rows for bit in row]
+    bits += [0] * (-len(bits) % 8)
+    return bytes(sum(bit << (7 - i) for i, bit in enumerate(bits[n:n + 8]))
+                 for n in range(0, len(bits), 8))
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+"""Generate time_glyphs.h: the time font's digits and colon as byte-aligned bitmaps.
+
+GFX fonts pack each glyph as one run of bits, so drawing one means a pixel at a time. Here every
+row starts on a byte, which lets FrameBuffer blit a byte at a time, and the metrics sit in a
+small table so the time can be measured without walking the font.
+
+    python3 tools/glyph_cache.py MadeSunflower39pt7b.h > time_glyphs.h
+"""
+import sys
+
+from gfxfont import glyph_rows, read_font
+
+CHARS = '0123456789:'
+
+
+def main():
+    font = read_font(sys.argv[1])
+    bitmaps = []
+    metrics = []
+    for char in CHARS:
+        _, width, height, x_advance, x_offset, y_offset = font['glyphs'][ord(char) - font['first']]
+        metrics.append((len(bitmaps), width, height, x_advance, x_offset, y_offset, char))
+        for row in glyph_rows(font, char):
+            row += [0] * (-width % 8)
+            bitmaps += [sum(bit << (7 - i) for i, bit in enumerate(row[n:n + 8]))
+                        for n in range(0, len(row), 8)]
+
+    print('#ifndef TIME_GLYPHS_H')
+    print('#define TIME_GLYPHS_H')
+    print()
+    print('// Generated by tools/glyph_cache.py from %s, do not edit.' % font['name'])
+    print('// Glyphs for "%s" with each row padded to a whole byte' % CHARS)
+    print()
+    print('#define TIME_GLYPH_FIRST \'%s\'' % CHARS[0])
+    print('#define TIME_GLYPH_COUNT %d' % len(CHARS))
+    print()
+    print('struct TimeGlyph {')
+    print('    uint16_t offset;')
+    print('    uint8_t width;')
+    print('    uint8_t height;')
+    print('    uint8_t xAdvance;')
+    print('    int8_t xOffset;')
+    print('    int8_t yOffset;')
+    print('};')
+    print()
+    print('const TimeGlyph timeGlyphs[TIME_GLYPH_COUNT] PROGMEM = {')
+    for offset, width, height, x_advance, x_offset, y_offset, char in metrics:
+        print('    {%5d, %3d, %3d, %3d, %3d, %4d}, // \'%s\'' % (
+            offset, width, height, x_advance, x_offset, y_offset, char))
+    print('};')
+    print()
+    print('const uint8_t timeGlyphBitmaps[%d] PROGMEM = {' % len(bitmaps))
+    for n in range(0, len(bitmaps), 16):
+        print('    ' + ' '.join('0x%02X,' % b for b in bitmaps[n:n + 16]))
+    print('};')
+    print()
+    print('#endif')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Generate orbit_lookup.h: sun and moon icon positions for every minute of the day.
+
+Positions come from a quarter-wave sine table in Q24 with one step per minute (a day is one
+turn), truncated toward zero like the float to int casts drawSun used to do. Each coordinate is
+stored as a uint8 with half the icon size added, which keeps every coordinate inside 0..255.
+
+    python3 tools/orbit_table.py > orbit_lookup.h
+"""
+import math
+
+STEPS = 360  # minutes in a quarter turn
+SHIFT = 24
+ONE = 1 << SHIFT
+DISPLAY_CENTRE = 100
+BORDER_RADIUS = 98  # DISPLAY_HEIGHT / 2 - BORDER_THICKNESS / 2
+ZERO_MINUTE = 360   # 6am sits at angle 0 (3 o'clock on the face)
+SUN_SIZE = 65
+MOON_SIZE = 33
+MINUTES = STEPS * 4
+
+
+def sine_table():
+    return [int(round(math.sin(i / STEPS * math.pi / 2) * ONE)) for i in range(STEPS + 1)]
+
+
+def sin_steps(table, step):
+    step %= MINUTES
+    quadrant, offset = divmod(step, STEPS)
+    return [table[offset], table[STEPS - offset], -table[offset], -table[STEPS - offset]][quadrant]
+
+
+def trunc_trig(value):
+    return value >> SHIFT if value >= 0 else -((-value) >> SHIFT)
+
+
+def main():
+    table = sine_table()
+    rows = []
+    for minute in range(MINUTES):
+        angle = minute - ZERO_MINUTE
+        orbit_x = BORDER_RADIUS * sin_steps(table, angle + STEPS)
+        orbit_y = BORDER_RADIUS * sin_steps(table, angle)
+        row = []
+        for size in (SUN_SIZE, MOON_SIZE):
+            x = trunc_trig(((DISPLAY_CENTRE - size // 2) << SHIFT) + orbit_x)
+            y = trunc_trig(((DISPLAY_CENTRE - size // 2) << SHIFT) - orbit_y)
+            row += [x + size // 2, y + size // 2]
+        assert all(0 <= v <= 255 for v in row)
+        rows.append(row)
+
+    print('#ifndef ORBIT_LOOKUP_H')
+    print('#define ORBIT_LOOKUP_H')
+    print()
+    print('// Generated by tools/orbit_table.py, do not edit.')
+    print('// Top-left of the sun (%dpx) and moon (%dpx) icons for each minute of the day,' % (SUN_SIZE, MOON_SIZE))
+    print('// each stored plus the ORBIT_*_OFFSET below so it fits a uint8')
+    print()
+    print('#define ORBIT_SUN_X 0')
+    print('#define ORBIT_SUN_Y 1')
+    print('#define ORBIT_MOON_X 2')
+    print('#define ORBIT_MOON_Y 3')
+    print('#define ORBIT_SUN_OFFSET %d' % (SUN_SIZE // 2))
+    print('#define ORBIT_MOON_OFFSET %d' % (MOON_SIZE // 2))
+    print()
+    print('const uint8_t orbitLookup[%d][4] PROGMEM = {' % MINUTES)
+    for minute, row in enumerate(rows):
+        sep = ',' if minute + 1 < MINUTES else ''
+        print('/* %4d */   {%s}%s' % (minute, ','.join(str(v) for v in row), sep))
+    print('};')
+    print()
+    print('#endif')
+
+
+if __name__ == '__main__':
+    main()
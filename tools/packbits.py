@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""Convert 1bpp bitmaps to PackBits-compressed PROGMEM arrays for FrameBuffer::drawPackedBitmapWindow.
+
+Inputs are either PNGs (a pixel is set when it is bright and opaque, like image2cpp with a
+black background) or arrays already in a header, given as header.h:arrayName[:WxH].
+
+    python3 tools/packbits.py bitmaps/backgroundMask.png > packed.h
+    python3 tools/packbits.py assets.h:backgroundMask:200x200 assets.h:backgroundRing:200x200
+
+Only the standard library is used so this runs anywhere Python 3 does.
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+def read_png(path, threshold):
+    """Decode a non-interlaced 8-bit PNG into rows of 0/1 pixels."""
+    data = open(path, 'rb').read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit('%s: not a PNG' % path)
+    pos = 8
+    idat = b''
+    while pos < len(data):
+        length, = struct.unpack('>I', data[pos:pos + 4])
+        kind = data[pos + 4:pos + 8]
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            width, height, depth, colour, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+    if depth != 8 or interlace or colour not in (0, 2, 4, 6):
+        sys.exit('%s: only 8-bit non-interlaced grey/RGB(A) PNGs are supported' % path)
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}[colour]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    pixels = []
+    offset = 0
+    for _ in range(height):
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        offset += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xff
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        row = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            grey = sum(px[:3]) // 3 if channels >= 3 else px[0]
+            alpha = px[-1] if channels in (2, 4) else 255
+            row.append(1 if grey * alpha // 255 >= threshold else 0)
+        pixels.append(row)
+        prev = line
+    return width, height, pixels
+
+
+def pack_rows(width, height, pixels):
+    """Pack 0/1 rows into Adafruit/GxEPD2 layout: MSB first, rows padded to a byte."""
+    out = bytearray()
+    for y in range(height):
+        for bx in range(0, width, 8):
+            byte = 0
+            for i in range(8):
+                if bx + i < width and pixels[y][bx + i]:
+                    byte |= 0x80 >> i
+            out.append(byte)
+    return bytes(out)
+
+
+def read_header_array(spec):
+    parts = spec.split(':')
+    path, name = parts[0], parts[1]
+    src = open(path).read()
+    match = re.search(r'\b' + re.escape(name) + r'\s*\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', src, re.S)
+    if not match:
+        sys.exit('%s: no array %s' % (path, name))
+    data = bytes(int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]{2}', match.group(1)))
+    if len(parts) > 2:
+        width, height = (int(v) for v in parts[2].split('x'))
+    else:
+        dims = re.search(r"//\s*'[^']*',\s*(\d+)x(\d+)px\s*\n[^\n]*\b" + re.escape(name) + r'\b', src)
+        if not dims:
+            sys.exit('%s: give the size of %s as %s:WxH' % (path, name, spec))
+        width, height = int(dims.group(1)), int(dims.group(2))
+    if len(data) != (width + 7) // 8 * height:
+        sys.exit('%s: %d bytes does not match %dx%d' % (name, len(data), width, height))
+    return name, width, height, data
+
+
+def packbits(data):
+    """Apple PackBits: n in 0..127 copies n+1 literal bytes, n in -127..-1 repeats the next byte 1-n times."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 128:
+            run += 1
+        if run >= 2:
+            out += bytes([(257 - run) & 0xff, data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 1 < len(data) and data[i + 1] == data[i]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(packed, size):
+    out = bytearray()
+    i = 0
+    while len(out) < size:
+        n = packed[i]
+        if n < 128:
+            out += packed[i + 1:i + 2 + n]
+            i += 2 + n
+        elif n > 128:
+            out += bytes([packed[i + 1]]) * (257 - n)
+            i += 2
+        else:
+            i += 1
+    return bytes(out)
+
+
+def format_array(name, width, height, raw, packed):
+    lines = ["// '%s', %dx%dpx, packbits %d -> %d bytes" % (name, width, height, len(raw), len(packed)),
+             'const unsigned char %sPacked [] PROGMEM = {' % name]
+    for i in range(0, len(packed), 16):
+        lines.append('\t' + ', '.join('0x%02x' % b for b in packed[i:i + 16]) + ', ')
+    lines[-1] = lines[-1].rstrip(', ')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('inputs', nargs='+', help='PNG files or header.h:arrayName[:WxH]')
+    parser.add_argument('--threshold', type=int, default=128, help='brightness (0-255) at which a PNG pixel is set')
+    parser.add_argument('--guard', default='PACKED_BITMAPS_H', help='include guard for the generated header')
+    args = parser.parse_args()
+
+    arrays = []
+    total_raw = total_packed = 0
+    for spec in args.inputs:
+        if spec.lower().endswith('.png'):
+            width, height, pixels = read_png(spec, args.threshold)
+            name = os.path.splitext(os.path.basename(spec))[0]
+            raw = pack_rows(width, height, pixels)
+        else:
+            name, width, height, raw = read_header_array(spec)
+        packed = packbits(raw)
+        assert unpackbits(packed, len(raw)) == raw
+        total_raw += len(raw)
+        total_packed += len(packed)
+        arrays.append(format_array(name, width, height, raw, packed))
+
+    print('#ifndef %s' % args.guard)
+    print('#define %s' % args.guard)
+    print()
+    print('// Generated by tools/packbits.py from: %s' % ' '.join(os.path.basename(s) for s in args.inputs))
+    print('// Draw with FrameBuffer::drawPackedBitmapWindow. Total %d -> %d bytes.' % (total_raw, total_packed))
+    print()
+    print('\n'.join(arrays))
+    print()
+    print('#endif')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Push a shopping list to the watch over Wi-Fi.
+
+Pick "Sync List" on the watch, then run with the address it shows and a text file with one
+item per line:
+
+    python3 tools/sync_list.py 192.168.1.42 list.txt
+
+The current list is fetched first and only the differences are sent, as the edit script
+described in shopping_list.h. Use --dry-run to print the script instead of sending it.
+"""
+import argparse
+import difflib
+import sys
+import urllib.error
+import urllib.request
+
+MAX_ITEM_LEN = 31  # SHOPPING_ITEM_MAX_LEN
+MAX_ITEMS = 16384  # SHOPPING_LIST_MAX_ITEMS
+
+
+def fetch(url):
+    with urllib.request.urlopen(url, timeout=10) as response:
+        lines = response.read().decode('utf-8').split('\n')
+    return lines[0], [line for line in lines[1:] if line]
+
+
+def edit_script(base, old, new):
+    script = ['base %s' % base]
+    for op, i1, i2, j1, j2 in difflib.SequenceMatcher(a=old, b=new, autojunk=False).get_opcodes():
+        if op == 'equal':
+            script.append('= %d' % (i2 - i1))
+            continue
+        if i2 > i1:
+            script.append('- %d' % (i2 - i1))
+        script.extend('+ %s' % item for item in new[j1:j2])
+    return '\n'.join(script) + '\n'
+
+
+def read_items(path):
+    with open(path, encoding='utf-8') as f:
+        items = [line.strip() for line in f if line.strip()]
+    for item in items:
+        if len(item.encode('utf-8')) > MAX_ITEM_LEN:
+            sys.exit('item longer than %d bytes: %s' % (MAX_ITEM_LEN, item))
+    if len(items) > MAX_ITEMS:
+        sys.exit('more than %d items' % MAX_ITEMS)
+    return items
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('host', help='address shown on the watch, optionally with :port')
+    parser.add_argument('list', help='text file, one item per line')
+    parser.add_argument('--dry-run', action='store_true', help='print the edit script only')
+    args = parser.parse_args()
+
+    url = 'http://%s/list' % args.host
+    new = read_items(args.list)
+    base, old = fetch(url)
+    script = edit_script(base, old, new)
+    if args.dry_run:
+        sys.stdout.write(script)
+        return
+    request = urllib.request.Request(url, data=script.encode('utf-8'), method='POST',
+                                     headers={'Content-Type': 'text/plain'})
+    try:
+        with urllib.request.urlopen(request, timeout=30) as response:
+            sys.stdout.write(response.read().decode('utf-8'))
+    except urllib.error.HTTPError as e:
+        sys.exit('%d %s' % (e.code, e.read().decode('utf-8').strip()))
+
+
+if __name__ == '__main__':
+    main()